@@ -0,0 +1,337 @@
+#ifndef ASSIGNMENT_HPP
+#define ASSIGNMENT_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "HopcroftKarp/hopcroft_karp.hpp"
+#include "Khun/khun.hpp"
+
+namespace Aads {
+
+// Every left vertex (worker) is matched with a distinct right vertex (task)
+struct Assignment {
+  int64_t cost = 0;
+  Matching matching;
+};
+
+// Minimum cost assignment of rows to columns of a dense row-major cost
+// matrix, rows <= cols. Rows are added one by one, and each is matched by a
+// shortest augmenting path in reduced costs, found by a Dijkstra-like scan of
+// the columns, as in the augmentation phase of Jonker-Volgenant. Dual
+// potentials keep the reduced costs non-negative. O(rows^2 * cols) time.
+// Returns std::nullopt if rows > cols
+inline std::optional<Assignment> HungarianAssignment(
+    size_t rows, size_t cols, std::span<const int64_t> costs) {
+  assert(costs.size() == rows * cols);
+  if (rows > cols) {
+    return std::nullopt;
+  }
+  constexpr int64_t kInf = std::numeric_limits<int64_t>::max();
+  constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+
+  // Column cols is a virtual one matched with the row being added
+  std::vector<int64_t> row_potential(rows, 0);
+  std::vector<int64_t> col_potential(cols + 1, 0);
+  std::vector<uint32_t> row_of(cols + 1, kNone);
+  std::vector<uint32_t> prev_col(cols + 1, kNone);
+  std::vector<int64_t> min_reduced(cols + 1);
+  std::vector<bool> used(cols + 1);
+
+  for (uint32_t row = 0; row < rows; ++row) {
+    uint32_t col = cols;
+    row_of[col] = row;
+    std::fill(min_reduced.begin(), min_reduced.end(), kInf);
+    std::fill(used.begin(), used.end(), false);
+
+    do {
+      used[col] = true;
+      uint32_t cur_row = row_of[col];
+      const int64_t* cur_costs = costs.data() + cur_row * cols;
+      int64_t delta = kInf;
+      uint32_t next_col = kNone;
+
+      for (uint32_t other = 0; other < cols; ++other) {
+        if (used[other]) {
+          continue;
+        }
+        int64_t reduced = cur_costs[other] - row_potential[cur_row] -
+                          col_potential[other];
+        if (reduced < min_reduced[other]) {
+          min_reduced[other] = reduced;
+          prev_col[other] = col;
+        }
+        if (min_reduced[other] < delta) {
+          delta = min_reduced[other];
+          next_col = other;
+        }
+      }
+
+      for (uint32_t other = 0; other <= cols; ++other) {
+        if (used[other]) {
+          row_potential[row_of[other]] += delta;
+          col_potential[other] -= delta;
+        } else {
+          min_reduced[other] -= delta;
+        }
+      }
+      col = next_col;
+    } while (row_of[col] != kNone);
+
+    // Shifts the rows along the path
+    while (col != cols) {
+      uint32_t prev = prev_col[col];
+      row_of[col] = row_of[prev];
+      col = prev;
+    }
+  }
+
+  Assignment res{0, Matching(rows, cols)};
+  for (uint32_t col = 0; col < cols; ++col) {
+    if (row_of[col] != kNone) {
+      res.matching.Match(row_of[col], col);
+      res.cost += costs[row_of[col] * cols + col];
+    }
+  }
+  return res;
+}
+
+struct AuctionParams {
+  // 0 means std::thread::hardware_concurrency()
+  size_t threads = 0;
+  // Epsilon is divided by it between the scaling phases
+  int64_t epsilon_factor = 4;
+};
+
+namespace {
+
+// Forward auction with epsilon scaling on benefits -cost * (n + 1). With
+// integer benefits, epsilon = 1 is less than 1 / n in the original costs,
+// so the last phase ends with an optimal assignment.
+// If there are more right vertices than left ones, the assignment is only
+// optimal if no unassigned right vertex is more expensive than an assigned
+// one. Scaling phases carry prices over and break this, so such instances
+// run a single phase with epsilon = 1 from zero prices, where right
+// vertices that never got a bid keep price 0
+class AuctionSolver {
+ public:
+  AuctionSolver(const BipartiteGraph& graph, std::span<const int64_t> costs,
+                const AuctionParams& params)
+      : graph_(graph),
+        threads_(params.threads),
+        benefit_(costs.size()),
+        price_(graph.CountRight(), 0),
+        best_bid_(graph.CountRight()),
+        best_bidder_(graph.CountRight()),
+        round_(graph.CountRight(), 0),
+        assigned_arc_(graph.CountLeft()),
+        matching_(graph.CountLeft(), graph.CountRight()) {
+    if (threads_ == 0) {
+      threads_ = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    int64_t scale = graph.CountLeft() + 1;
+    int64_t min_benefit = 0;
+    int64_t max_benefit = 0;
+    for (size_t arc = 0; arc < costs.size(); ++arc) {
+      benefit_[arc] = -costs[arc] * scale;
+      min_benefit = std::min(min_benefit, benefit_[arc]);
+      max_benefit = std::max(max_benefit, benefit_[arc]);
+    }
+
+    if (graph.CountLeft() == graph.CountRight()) {
+      epsilon_ = std::max<int64_t>((max_benefit - min_benefit) / 2, 1);
+    }
+    epsilon_factor_ = std::max<int64_t>(params.epsilon_factor, 2);
+
+    arc_head_.resize(graph.CountEdges());
+    for (uint32_t left = 0; left < graph.CountLeft(); ++left) {
+      auto adj = graph.GetAdj(left);
+      std::copy(adj.begin(), adj.end(),
+                arc_head_.begin() + graph.FirstArc(left));
+    }
+  }
+
+  Assignment Run(std::span<const int64_t> costs) {
+    while (true) {
+      RunPhase();
+      if (epsilon_ == 1) {
+        break;
+      }
+      epsilon_ = std::max<int64_t>(epsilon_ / epsilon_factor_, 1);
+    }
+
+    Assignment res{0, matching_};
+    for (uint32_t left = 0; left < graph_.CountLeft(); ++left) {
+      res.cost += costs[assigned_arc_[left]];
+    }
+    return res;
+  }
+
+ private:
+  static constexpr size_t kParallelThreshold = 1024;
+
+  struct Bid {
+    size_t arc;
+    int64_t price;
+  };
+
+  // Starts from no assignment and the prices of the previous phase
+  void RunPhase() {
+    matching_ = Matching(graph_.CountLeft(), graph_.CountRight());
+    unassigned_.resize(graph_.CountLeft());
+    for (uint32_t left = 0; left < graph_.CountLeft(); ++left) {
+      unassigned_[left] = left;
+    }
+
+    while (not unassigned_.empty()) {
+      bids_.resize(unassigned_.size());
+      ComputeBids();
+      ResolveBids();
+    }
+  }
+
+  // Bids of all unassigned left vertices against the same prices, in
+  // parallel chunks
+  void ComputeBids() {
+    size_t threads =
+        unassigned_.size() < kParallelThreshold ? 1 : threads_;
+    size_t chunk = (unassigned_.size() + threads - 1) / threads;
+
+    auto bid_chunk = [&](size_t thread) {
+      size_t end = std::min(unassigned_.size(), (thread + 1) * chunk);
+      for (size_t idx = thread * chunk; idx < end; ++idx) {
+        bids_[idx] = MakeBid(unassigned_[idx]);
+      }
+    };
+
+    if (threads == 1) {
+      bid_chunk(0);
+      return;
+    }
+    std::vector<std::thread> workers;
+    for (size_t thread = 0; thread < threads; ++thread) {
+      workers.emplace_back(bid_chunk, thread);
+    }
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+
+  // The best object gets the price that makes it as good as the second
+  // best one, plus epsilon
+  Bid MakeBid(uint32_t left) const {
+    constexpr int64_t kNoValue = std::numeric_limits<int64_t>::min();
+    size_t first = graph_.FirstArc(left);
+    auto adj = graph_.GetAdj(left);
+    size_t best_arc = first;
+    int64_t best = kNoValue;
+    int64_t second = kNoValue;
+
+    for (size_t idx = 0; idx < adj.size(); ++idx) {
+      int64_t value = benefit_[first + idx] - price_[adj[idx]];
+      if (value > best) {
+        second = best;
+        best = value;
+        best_arc = first + idx;
+      } else if (value > second) {
+        second = value;
+      }
+    }
+
+    int64_t increment = epsilon_;
+    if (second != kNoValue) {
+      increment += best - second;
+    }
+    return {best_arc, price_[RightOf(best_arc)] + increment};
+  }
+
+  // Every object goes to its highest bidder, the previous owners and the
+  // other bidders stay unassigned
+  void ResolveBids() {
+    current_round_ += 1;
+    touched_.clear();
+    for (size_t idx = 0; idx < bids_.size(); ++idx) {
+      uint32_t right = RightOf(bids_[idx].arc);
+      if (round_[right] != current_round_) {
+        round_[right] = current_round_;
+        touched_.push_back(right);
+        best_bid_[right] = bids_[idx].price;
+        best_bidder_[right] = idx;
+      } else if (bids_[idx].price > best_bid_[right]) {
+        best_bid_[right] = bids_[idx].price;
+        best_bidder_[right] = idx;
+      }
+    }
+
+    next_unassigned_.clear();
+    for (size_t idx = 0; idx < bids_.size(); ++idx) {
+      uint32_t right = RightOf(bids_[idx].arc);
+      if (best_bidder_[right] != idx) {
+        next_unassigned_.push_back(unassigned_[idx]);
+      }
+    }
+    for (uint32_t right : touched_) {
+      size_t idx = best_bidder_[right];
+      uint32_t previous = matching_.MatchOfRight(right);
+      if (previous != Matching::kFree) {
+        next_unassigned_.push_back(previous);
+      }
+      price_[right] = best_bid_[right];
+      matching_.Match(unassigned_[idx], right);
+      assigned_arc_[unassigned_[idx]] = bids_[idx].arc;
+    }
+    std::swap(unassigned_, next_unassigned_);
+  }
+
+  uint32_t RightOf(size_t arc) const { return arc_head_[arc]; }
+
+  const BipartiteGraph& graph_;
+  size_t threads_;
+  int64_t epsilon_ = 1;
+  int64_t epsilon_factor_ = 4;
+  std::vector<int64_t> benefit_;
+  std::vector<uint32_t> arc_head_;
+  std::vector<int64_t> price_;
+  std::vector<int64_t> best_bid_;
+  std::vector<size_t> best_bidder_;
+  // Bidding round in which the object last got a bid
+  std::vector<size_t> round_;
+  size_t current_round_ = 0;
+  std::vector<size_t> assigned_arc_;
+  std::vector<uint32_t> unassigned_;
+  std::vector<uint32_t> next_unassigned_;
+  std::vector<uint32_t> touched_;
+  std::vector<Bid> bids_;
+  Matching matching_;
+};
+
+}  // namespace
+
+// Minimum cost assignment of all left vertices of a sparse graph, where
+// costs[arc] is the cost of arc numbered as in BipartiteGraph::FirstArc.
+// Runs the auction algorithm: unassigned left vertices bid for their best
+// right vertex and raise its price, the bids of a round are computed in
+// parallel. Returns std::nullopt if some left vertex can't be assigned
+inline std::optional<Assignment> AuctionAssignment(
+    const BipartiteGraph& graph, std::span<const int64_t> costs,
+    const AuctionParams& params = {}) {
+  assert(costs.size() == graph.CountEdges());
+  // Without a perfect matching of the left side bidding never stops
+  Matching matching(graph.CountLeft(), graph.CountRight());
+  if (HopcroftKarp().Run(graph, matching) < graph.CountLeft()) {
+    return std::nullopt;
+  }
+
+  return AuctionSolver(graph, costs, params).Run(costs);
+}
+
+}  // namespace Aads
+
+#endif  // ASSIGNMENT_HPP
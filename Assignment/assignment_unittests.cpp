@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Assignment/assignment.hpp"
+
+namespace {
+
+std::vector<int64_t> RandomCosts(size_t size, uint32_t seed) {
+  std::mt19937 rnd(seed);
+  std::vector<int64_t> costs(size);
+  for (int64_t& cost : costs) {
+    cost = rnd() % 1000;
+  }
+  return costs;
+}
+
+int64_t BruteForceCost(size_t rows, size_t cols,
+                       const std::vector<int64_t>& costs) {
+  std::vector<size_t> perm(cols);
+  std::iota(perm.begin(), perm.end(), 0);
+  int64_t best = std::numeric_limits<int64_t>::max();
+  do {
+    int64_t cost = 0;
+    for (size_t row = 0; row < rows; ++row) {
+      cost += costs[row * cols + perm[row]];
+    }
+    best = std::min(best, cost);
+  } while (std::next_permutation(perm.begin(), perm.end()));
+  return best;
+}
+
+// Sparse graph where left i always has an arc to right i
+struct SparseInstance {
+  Aads::BipartiteGraph graph;
+  std::vector<int64_t> costs;
+  std::vector<int64_t> dense;
+};
+
+SparseInstance RandomSparse(size_t size, size_t degree, uint32_t seed) {
+  constexpr int64_t kMissing = 1'000'000'000;
+  std::mt19937 rnd(seed);
+  std::vector<std::pair<uint32_t, uint32_t>> edges;
+  std::vector<int64_t> edge_costs;
+  SparseInstance res;
+  res.dense.assign(size * size, kMissing);
+
+  for (uint32_t left = 0; left < size; ++left) {
+    for (size_t idx = 0; idx < degree; ++idx) {
+      uint32_t right = idx == 0 ? left : rnd() % size;
+      int64_t cost = rnd() % 1000;
+      edges.emplace_back(left, right);
+      edge_costs.push_back(cost);
+      res.dense[left * size + right] =
+          std::min(res.dense[left * size + right], cost);
+    }
+  }
+  // Edges are grouped by left already, so arcs keep their order
+  res.graph = Aads::BipartiteGraph(size, size, edges);
+  res.costs = edge_costs;
+  return res;
+}
+
+}  // namespace
+
+TEST(AssignmentTest, HungarianSmall) {
+  std::vector<int64_t> costs = {4, 1, 3,
+                                2, 0, 5,
+                                3, 2, 2};
+  auto res = Aads::HungarianAssignment(3, 3, costs);
+
+  ASSERT_TRUE(res.has_value());
+  EXPECT_EQ(res->cost, 5);
+  EXPECT_EQ(res->matching.MatchOfLeft(0), 1);
+  EXPECT_EQ(res->matching.MatchOfLeft(1), 0);
+  EXPECT_EQ(res->matching.MatchOfLeft(2), 2);
+
+  costs.resize(6);
+  EXPECT_FALSE(Aads::HungarianAssignment(3, 2, costs).has_value());
+}
+
+TEST(AssignmentTest, HungarianSameAsBruteForce) {
+  for (uint32_t seed = 0; seed < 20; ++seed) {
+    size_t rows = 1 + seed % 6;
+    size_t cols = rows + seed % 3;
+    std::vector<int64_t> costs = RandomCosts(rows * cols, seed);
+
+    auto res = Aads::HungarianAssignment(rows, cols, costs);
+    ASSERT_TRUE(res.has_value());
+    EXPECT_EQ(res->matching.Size(), rows);
+    EXPECT_EQ(res->cost, BruteForceCost(rows, cols, costs));
+  }
+}
+
+TEST(AssignmentTest, AuctionSameAsHungarian) {
+  for (uint32_t seed = 0; seed < 5; ++seed) {
+    SparseInstance instance = RandomSparse(100, 4, seed);
+
+    auto expected = Aads::HungarianAssignment(100, 100, instance.dense);
+    auto res = Aads::AuctionAssignment(instance.graph, instance.costs);
+    ASSERT_TRUE(res.has_value());
+    EXPECT_EQ(res->cost, expected->cost);
+    EXPECT_EQ(res->matching.Size(), 100);
+  }
+}
+
+TEST(AssignmentTest, AuctionMoreRightVertices) {
+  constexpr int64_t kMissing = 1'000'000'000;
+  std::mt19937 rnd(7);
+  for (size_t iter = 0; iter < 5; ++iter) {
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    std::vector<int64_t> costs;
+    std::vector<int64_t> dense(50 * 80, kMissing);
+    for (uint32_t left = 0; left < 50; ++left) {
+      for (size_t idx = 0; idx < 4; ++idx) {
+        uint32_t right = idx == 0 ? left : rnd() % 80;
+        edges.emplace_back(left, right);
+        costs.push_back(rnd() % 1000);
+        dense[left * 80 + right] =
+            std::min(dense[left * 80 + right], costs.back());
+      }
+    }
+
+    auto expected = Aads::HungarianAssignment(50, 80, dense);
+    auto res = Aads::AuctionAssignment(Aads::BipartiteGraph(50, 80, edges),
+                                       costs);
+    ASSERT_TRUE(res.has_value());
+    EXPECT_EQ(res->cost, expected->cost);
+  }
+}
+
+TEST(AssignmentTest, AuctionNegativeAndEqualCosts) {
+  Aads::BipartiteGraph graph(2, 3, {{0, 0}, {0, 1}, {1, 0}, {1, 2}});
+  std::vector<int64_t> costs = {-5, -5, -5, 7};
+
+  auto res = Aads::AuctionAssignment(graph, costs);
+  ASSERT_TRUE(res.has_value());
+  EXPECT_EQ(res->cost, -10);
+  EXPECT_EQ(res->matching.MatchOfLeft(0), 1);
+}
+
+TEST(AssignmentTest, AuctionInfeasible) {
+  Aads::BipartiteGraph graph(2, 2, {{0, 0}, {1, 0}});
+  std::vector<int64_t> costs = {1, 1};
+  EXPECT_FALSE(Aads::AuctionAssignment(graph, costs).has_value());
+}
+
+TEST(AssignmentTest, ParallelAuction) {
+  SparseInstance instance = RandomSparse(3000, 5, 42);
+
+  auto single = Aads::AuctionAssignment(instance.graph, instance.costs,
+                                        {.threads = 1});
+  auto parallel = Aads::AuctionAssignment(instance.graph, instance.costs,
+                                          {.threads = 4});
+  ASSERT_TRUE(single.has_value());
+  ASSERT_TRUE(parallel.has_value());
+  EXPECT_EQ(single->cost, parallel->cost);
+  EXPECT_EQ(parallel->matching.Size(), 3000);
+}
@@ -0,0 +1,416 @@
+#ifndef CONTRACTION_HIERARCHIES_HPP
+#define CONTRACTION_HIERARCHIES_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <queue>
+#include <span>
+#include <vector>
+
+#include "Dijkstra/dijkstra_engine.hpp"
+
+namespace Aads {
+
+struct ContractionParams {
+  // A witness search gives up after settling this many vertices and the
+  // shortcut is added, which is always safe
+  size_t witness_settle_limit = 64;
+};
+
+namespace {
+
+using ArcList = std::vector<std::vector<StaticGraph::Arc>>;
+
+// Contracts vertices one by one in the order of the edge difference
+// heuristic, adding shortcuts that preserve distances between the remaining
+// vertices
+class HierarchyBuilder {
+ public:
+  HierarchyBuilder(const StaticGraph& graph, const ContractionParams& params)
+      : params_(params),
+        out_(graph.CountVertices()),
+        in_(graph.CountVertices()),
+        up_(graph.CountVertices()),
+        down_(graph.CountVertices()),
+        contracted_(graph.CountVertices()),
+        deleted_neighbours_(graph.CountVertices()),
+        workspace_(graph.CountVertices()) {
+    for (size_t vertex = 0; vertex < graph.CountVertices(); ++vertex) {
+      for (StaticGraph::Arc arc : graph.GetAdj(vertex)) {
+        // Loops never lie on shortest paths
+        if (arc.to != vertex) {
+          AddArc(vertex, arc.to, arc.weight);
+        }
+      }
+    }
+    original_arcs_ = arcs_count_;
+  }
+
+  // Fills rank of every vertex and its upward arcs: `up` are arcs to higher
+  // ranked vertices, `down` are arcs from higher ranked vertices reversed
+  void Build(std::vector<uint32_t>& rank, ArcList& up, ArcList& down) {
+    using Item = std::pair<int64_t, uint32_t>;
+    std::priority_queue<Item, std::vector<Item>, std::greater<>> queue;
+    for (uint32_t vertex = 0; vertex < out_.size(); ++vertex) {
+      queue.push({Priority(vertex), vertex});
+    }
+
+    rank.assign(out_.size(), 0);
+    uint32_t next_rank = 0;
+    while (not queue.empty()) {
+      uint32_t vertex = queue.top().second;
+      queue.pop();
+
+      // Lazy update: priorities of the queue are outdated lower bounds
+      int64_t priority = Priority(vertex);
+      if (not queue.empty() and priority > queue.top().first) {
+        queue.push({priority, vertex});
+        continue;
+      }
+
+      Contract(vertex);
+      rank[vertex] = next_rank++;
+    }
+
+    up = std::move(up_);
+    down = std::move(down_);
+  }
+
+  size_t CountShortcuts() const { return arcs_count_ - original_arcs_; }
+
+ private:
+  int64_t Priority(uint32_t vertex) {
+    int64_t degree = 0;
+    for (StaticGraph::Arc arc : out_[vertex]) {
+      degree += contracted_[arc.to] ? 0 : 1;
+    }
+    for (StaticGraph::Arc arc : in_[vertex]) {
+      degree += contracted_[arc.to] ? 0 : 1;
+    }
+    int64_t shortcuts = ProcessShortcuts(vertex, false);
+    return shortcuts - degree + deleted_neighbours_[vertex];
+  }
+
+  void Contract(uint32_t vertex) {
+    for (StaticGraph::Arc arc : out_[vertex]) {
+      if (not contracted_[arc.to]) {
+        up_[vertex].push_back(arc);
+        deleted_neighbours_[arc.to] += 1;
+      }
+    }
+    for (StaticGraph::Arc arc : in_[vertex]) {
+      if (not contracted_[arc.to]) {
+        down_[vertex].push_back(arc);
+        deleted_neighbours_[arc.to] += 1;
+      }
+    }
+
+    ProcessShortcuts(vertex, true);
+    contracted_[vertex] = true;
+    out_[vertex].clear();
+    in_[vertex].clear();
+  }
+
+  // Counts shortcuts needed to contract vertex, and adds them if apply is set
+  size_t ProcessShortcuts(uint32_t vertex, bool apply) {
+    size_t count = 0;
+
+    for (StaticGraph::Arc in_arc : in_[vertex]) {
+      if (contracted_[in_arc.to]) {
+        continue;
+      }
+      Distance max_length = 0;
+      for (StaticGraph::Arc out_arc : out_[vertex]) {
+        if (not contracted_[out_arc.to] and out_arc.to != in_arc.to) {
+          max_length = std::max<Distance>(max_length,
+                                          in_arc.weight + out_arc.weight);
+        }
+      }
+      if (max_length == 0) {
+        continue;
+      }
+
+      WitnessSearch(in_arc.to, vertex, max_length);
+      for (StaticGraph::Arc out_arc : out_[vertex]) {
+        Distance length = in_arc.weight + out_arc.weight;
+        if (contracted_[out_arc.to] or out_arc.to == in_arc.to or
+            workspace_.GetDistance(out_arc.to) <= length) {
+          continue;
+        }
+        count += 1;
+        if (apply) {
+          AddArc(in_arc.to, out_arc.to, length);
+        }
+      }
+    }
+
+    return count;
+  }
+
+  // Bounded Dijkstra from source over the remaining graph without `skip`
+  void WitnessSearch(uint32_t source, uint32_t skip, Distance max_length) {
+    using Item = std::pair<Distance, uint32_t>;
+    std::priority_queue<Item, std::vector<Item>, std::greater<>> queue;
+    workspace_.Reset();
+    workspace_.Relax(source, 0);
+    queue.push({0, source});
+    size_t settled = 0;
+
+    while (not queue.empty() and settled < params_.witness_settle_limit) {
+      auto [dist, vertex] = queue.top();
+      queue.pop();
+      if (dist > max_length) {
+        break;
+      }
+      if (dist != workspace_.GetDistance(vertex)) {
+        continue;
+      }
+      settled += 1;
+
+      for (StaticGraph::Arc arc : out_[vertex]) {
+        if (arc.to != skip and not contracted_[arc.to] and
+            workspace_.Relax(arc.to, dist + arc.weight)) {
+          queue.push({dist + arc.weight, arc.to});
+        }
+      }
+    }
+  }
+
+  // Keeps only the lightest of parallel arcs
+  void AddArc(uint32_t from, uint32_t to, Distance weight) {
+    for (StaticGraph::Arc& arc : out_[from]) {
+      if (arc.to == to) {
+        arc.weight = std::min<Distance>(arc.weight, weight);
+        for (StaticGraph::Arc& reversed : in_[to]) {
+          if (reversed.to == from) {
+            reversed.weight = arc.weight;
+          }
+        }
+        return;
+      }
+    }
+    out_[from].push_back({to, static_cast<uint32_t>(weight)});
+    in_[to].push_back({from, static_cast<uint32_t>(weight)});
+    arcs_count_ += 1;
+  }
+
+  const ContractionParams& params_;
+  // Arcs of the remaining graph, in_ stores reversed arcs
+  ArcList out_;
+  ArcList in_;
+  ArcList up_;
+  ArcList down_;
+  std::vector<bool> contracted_;
+  std::vector<int64_t> deleted_neighbours_;
+  SearchWorkspace workspace_;
+  size_t arcs_count_ = 0;
+  size_t original_arcs_ = 0;
+};
+
+}  // namespace
+
+// Vertices get ranks, and every shortest path can be found as an upward path
+// from the source and an upward path from the target that meet at the highest
+// ranked vertex. Shortcut weights must fit into uint32_t
+class ContractionHierarchy {
+ public:
+  ContractionHierarchy() = default;
+
+  explicit ContractionHierarchy(const StaticGraph& graph,
+                                const ContractionParams& params = {}) {
+    HierarchyBuilder builder(graph, params);
+    ArcList up;
+    ArcList down;
+    builder.Build(rank_, up, down);
+    shortcut_count_ = builder.CountShortcuts();
+    ToCsr(up, up_offsets_, up_arcs_);
+    ToCsr(down, down_offsets_, down_arcs_);
+  }
+
+  size_t CountVertices() const { return rank_.size(); }
+  size_t CountShortcuts() const { return shortcut_count_; }
+  uint32_t Rank(uint32_t vertex) const { return rank_[vertex]; }
+
+  // Arcs from vertex to higher ranked vertices
+  std::span<const StaticGraph::Arc> GetUp(uint32_t vertex) const {
+    return Slice(up_offsets_, up_arcs_, vertex);
+  }
+
+  // Arcs from higher ranked vertices to vertex, with `to` being their tail
+  std::span<const StaticGraph::Arc> GetDown(uint32_t vertex) const {
+    return Slice(down_offsets_, down_arcs_, vertex);
+  }
+
+  void Save(std::ostream& out) const {
+    Write(out, kMagic);
+    Write(out, static_cast<uint64_t>(shortcut_count_));
+    WriteVector(out, rank_);
+    WriteVector(out, up_offsets_);
+    WriteVector(out, up_arcs_);
+    WriteVector(out, down_offsets_);
+    WriteVector(out, down_arcs_);
+  }
+
+  // Returns false if the stream doesn't contain a saved hierarchy
+  bool Load(std::istream& in) {
+    uint64_t magic = 0;
+    uint64_t shortcut_count = 0;
+    if (not Read(in, magic) or magic != kMagic or
+        not Read(in, shortcut_count) or not ReadVector(in, rank_) or
+        not ReadVector(in, up_offsets_) or not ReadVector(in, up_arcs_) or
+        not ReadVector(in, down_offsets_) or not ReadVector(in, down_arcs_)) {
+      *this = ContractionHierarchy();
+      return false;
+    }
+    shortcut_count_ = shortcut_count;
+    return true;
+  }
+
+ private:
+  // "AADS CH1"
+  static constexpr uint64_t kMagic = 0x3148432053444141ULL;
+
+  static void ToCsr(const ArcList& lists, std::vector<uint32_t>& offsets,
+                    std::vector<StaticGraph::Arc>& arcs) {
+    offsets.assign(1, 0);
+    for (const std::vector<StaticGraph::Arc>& list : lists) {
+      arcs.insert(arcs.end(), list.begin(), list.end());
+      offsets.push_back(arcs.size());
+    }
+  }
+
+  static std::span<const StaticGraph::Arc> Slice(
+      const std::vector<uint32_t>& offsets,
+      const std::vector<StaticGraph::Arc>& arcs, uint32_t vertex) {
+    return std::span(arcs.data() + offsets[vertex],
+                     arcs.data() + offsets[vertex + 1]);
+  }
+
+  template <typename T>
+  static void Write(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  static void WriteVector(std::ostream& out, const std::vector<T>& values) {
+    Write(out, static_cast<uint64_t>(values.size()));
+    out.write(reinterpret_cast<const char*>(values.data()),
+              values.size() * sizeof(T));
+  }
+
+  template <typename T>
+  static bool Read(std::istream& in, T& value) {
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return static_cast<bool>(in);
+  }
+
+  template <typename T>
+  static bool ReadVector(std::istream& in, std::vector<T>& values) {
+    uint64_t size = 0;
+    if (not Read(in, size)) {
+      return false;
+    }
+    values.resize(size);
+    in.read(reinterpret_cast<char*>(values.data()), size * sizeof(T));
+    return static_cast<bool>(in);
+  }
+
+  size_t shortcut_count_ = 0;
+  std::vector<uint32_t> rank_;
+  std::vector<uint32_t> up_offsets_;
+  std::vector<StaticGraph::Arc> up_arcs_;
+  std::vector<uint32_t> down_offsets_;
+  std::vector<StaticGraph::Arc> down_arcs_;
+};
+
+// Bidirectional upward search. Keeps its workspace between queries
+class ContractionHierarchyQuery {
+ public:
+  explicit ContractionHierarchyQuery(const ContractionHierarchy& hierarchy)
+      : hierarchy_(hierarchy),
+        forward_(hierarchy.CountVertices()),
+        backward_(hierarchy.CountVertices()) {}
+
+  // Returns kUnreachable if there is no path
+  Distance Query(uint32_t source, uint32_t target) {
+    forward_.Reset(source);
+    backward_.Reset(target);
+    best_ = kUnreachable;
+
+    while (not forward_.done or not backward_.done) {
+      if (not forward_.done) {
+        Step(forward_, backward_, true);
+      }
+      if (not backward_.done) {
+        Step(backward_, forward_, false);
+      }
+    }
+
+    return best_;
+  }
+
+  size_t SettledCount() const {
+    return forward_.settled_count + backward_.settled_count;
+  }
+
+ private:
+  struct Side {
+    explicit Side(size_t vertex_count) : workspace(vertex_count) {}
+
+    void Reset(uint32_t start) {
+      workspace.Reset();
+      queue.Reset(StaticGraph());
+      settled_count = 0;
+      done = false;
+      workspace.Relax(start, 0);
+      queue.Push(start, 0);
+    }
+
+    SearchWorkspace workspace;
+    RadixHeap queue;
+    size_t settled_count = 0;
+    bool done = false;
+  };
+
+  void Step(Side& side, const Side& other, bool is_forward) {
+    if (side.queue.Empty()) {
+      side.done = true;
+      return;
+    }
+    auto [dist, vertex] = side.queue.Pop();
+    if (dist != side.workspace.GetDistance(vertex)) {
+      return;
+    }
+    // Upward paths only get longer
+    if (dist >= best_) {
+      side.done = true;
+      return;
+    }
+    side.settled_count += 1;
+
+    if (other.workspace.IsReached(vertex)) {
+      best_ = std::min(best_, dist + other.workspace.GetDistance(vertex));
+    }
+
+    auto arcs = is_forward ? hierarchy_.GetUp(vertex)
+                           : hierarchy_.GetDown(vertex);
+    for (StaticGraph::Arc arc : arcs) {
+      if (side.workspace.Relax(arc.to, dist + arc.weight)) {
+        side.queue.Push(arc.to, dist + arc.weight);
+      }
+    }
+  }
+
+  const ContractionHierarchy& hierarchy_;
+  Side forward_;
+  Side backward_;
+  Distance best_ = kUnreachable;
+};
+
+}  // namespace Aads
+
+#endif  // CONTRACTION_HIERARCHIES_HPP
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <vector>
+
+#include "ContractionHierarchies/contraction_hierarchies.hpp"
+#include "GraphGenerators/graph_generators.hpp"
+
+namespace {
+
+Aads::StaticGraph MakeStaticGraph(const Aads::GeneratedGraph& generated,
+                                  bool is_directed = false) {
+  std::vector<Aads::Edge<int>> edges;
+  for (const auto& edge : generated.edges) {
+    edges.emplace_back(edge.from, edge.to, edge.weight);
+  }
+  return Aads::StaticGraph(generated.vertex_count, edges, is_directed);
+}
+
+void ExpectSameAsDijkstra(const Aads::StaticGraph& graph,
+                          const Aads::ContractionHierarchy& hierarchy,
+                          uint32_t step) {
+  Aads::DijkstraEngine<> engine(graph);
+  Aads::ContractionHierarchyQuery query(hierarchy);
+
+  for (uint32_t source = 0; source < graph.CountVertices(); source += step) {
+    engine.Run(source);
+    for (uint32_t target = 0; target < graph.CountVertices(); ++target) {
+      ASSERT_EQ(query.Query(source, target), engine.GetDistance(target))
+          << source << " -> " << target;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(ContractionHierarchiesTest, SimpleGraph) {
+  Aads::StaticGraph graph(
+      5, {{0, 1, 10}, {0, 2, 5}, {2, 1, 3}, {1, 3, 1}, {4, 4, 1}});
+  Aads::ContractionHierarchy hierarchy(graph);
+  Aads::ContractionHierarchyQuery query(hierarchy);
+
+  EXPECT_EQ(hierarchy.CountVertices(), 5);
+  EXPECT_EQ(query.Query(0, 3), 9);
+  EXPECT_EQ(query.Query(3, 0), 9);
+  EXPECT_EQ(query.Query(3, 3), 0);
+  EXPECT_EQ(query.Query(0, 4), Aads::kUnreachable);
+}
+
+TEST(ContractionHierarchiesTest, ArcsGoUp) {
+  Aads::StaticGraph graph = MakeStaticGraph(Aads::Grid(10, 10, 1));
+  Aads::ContractionHierarchy hierarchy(graph);
+
+  for (uint32_t vertex = 0; vertex < graph.CountVertices(); ++vertex) {
+    for (Aads::StaticGraph::Arc arc : hierarchy.GetUp(vertex)) {
+      EXPECT_GT(hierarchy.Rank(arc.to), hierarchy.Rank(vertex));
+    }
+    for (Aads::StaticGraph::Arc arc : hierarchy.GetDown(vertex)) {
+      EXPECT_GT(hierarchy.Rank(arc.to), hierarchy.Rank(vertex));
+    }
+  }
+}
+
+TEST(ContractionHierarchiesTest, Path) {
+  Aads::StaticGraph graph =
+      MakeStaticGraph(Aads::LongPath(200, 2, 10, true));
+  Aads::ContractionHierarchy hierarchy(graph);
+
+  // Contracting a path vertex replaces its two edges with one shortcut
+  EXPECT_LT(hierarchy.CountShortcuts(), 2 * graph.CountVertices());
+  ExpectSameAsDijkstra(graph, hierarchy, 17);
+}
+
+TEST(ContractionHierarchiesTest, RoadLikeGrid) {
+  Aads::StaticGraph graph =
+      MakeStaticGraph(Aads::Grid(30, 30, 3, {0.2, 0.1, 50}));
+  Aads::ContractionHierarchy hierarchy(graph);
+  ExpectSameAsDijkstra(graph, hierarchy, 31);
+
+  Aads::ContractionHierarchyQuery query(hierarchy);
+  Aads::DijkstraEngine<> engine(graph);
+  EXPECT_EQ(query.Query(0, 899), engine.Query(0, 899));
+  EXPECT_LT(query.SettledCount(), engine.SettledCount());
+}
+
+TEST(ContractionHierarchiesTest, Directed) {
+  Aads::StaticGraph graph =
+      MakeStaticGraph(Aads::ErdosRenyi(300, 1200, 8, 20), true);
+  Aads::ContractionHierarchy hierarchy(graph);
+  ExpectSameAsDijkstra(graph, hierarchy, 23);
+}
+
+TEST(ContractionHierarchiesTest, TinyWitnessLimit) {
+  Aads::StaticGraph graph =
+      MakeStaticGraph(Aads::ErdosRenyi(200, 800, 4, 100));
+  Aads::ContractionHierarchy hierarchy(graph, {.witness_settle_limit = 1});
+  ExpectSameAsDijkstra(graph, hierarchy, 19);
+}
+
+TEST(ContractionHierarchiesTest, SaveLoad) {
+  Aads::StaticGraph graph =
+      MakeStaticGraph(Aads::Grid(15, 15, 5, {0.3, 0.1, 20}));
+  Aads::ContractionHierarchy hierarchy(graph);
+  std::stringstream stream;
+  hierarchy.Save(stream);
+
+  Aads::ContractionHierarchy loaded;
+  ASSERT_TRUE(loaded.Load(stream));
+  EXPECT_EQ(loaded.CountVertices(), hierarchy.CountVertices());
+  EXPECT_EQ(loaded.CountShortcuts(), hierarchy.CountShortcuts());
+  ExpectSameAsDijkstra(graph, loaded, 7);
+
+  std::stringstream garbage("not a hierarchy");
+  EXPECT_FALSE(loaded.Load(garbage));
+  EXPECT_EQ(loaded.CountVertices(), 0);
+}
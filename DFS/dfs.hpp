@@ -16,6 +16,7 @@ class Graph {
  public:
   using VertexT = T;
   using EdgeT = std::pair<VertexT, VertexT>;
+  static constexpr bool kIsDirected = is_directed;
 
   size_t CountVertexs() const { return adj_.size(); }
   size_t CountEdges() const { return edgecount_; }
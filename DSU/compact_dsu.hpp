@@ -0,0 +1,85 @@
+#ifndef COMPACT_DSU_HPP
+#define COMPACT_DSU_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Aads {
+
+// DSU with one Index per element. A slot holds the parent, or the component
+// size with the top bit set if the element is a root. Union by size and
+// iterative path halving, so long chains never recurse. With the default
+// uint32_t up to 2^31 - 1 elements fit
+template <typename Index = uint32_t>
+class CompactDSU {
+  static_assert(std::is_unsigned_v<Index>);
+
+ public:
+  explicit CompactDSU(size_t size = 0) { Grow(size); }
+
+  void Reserve(size_t capacity) { parent_.reserve(capacity); }
+
+  // Adds count singletons and returns the first of them
+  Index Grow(size_t count = 1) {
+    assert(parent_.size() + count < kRootBit);
+    Index first = parent_.size();
+    parent_.resize(parent_.size() + count, kRootBit | 1);
+    component_count_ += count;
+    return first;
+  }
+
+  size_t Size() const { return parent_.size(); }
+  size_t ComponentCount() const { return component_count_; }
+
+  size_t ComponentSize(Index idx) { return parent_[Find(idx)] & ~kRootBit; }
+
+  Index Find(Index idx) {
+    while (not IsRoot(parent_[idx])) {
+      Index parent = parent_[idx];
+      if (IsRoot(parent_[parent])) {
+        return parent;
+      }
+      // Path halving: skip the parent and continue from the grandparent
+      parent_[idx] = parent_[parent];
+      idx = parent_[idx];
+    }
+    return idx;
+  }
+
+  // Returns true if lhs and rhs were in different sets
+  bool Unite(Index lhs, Index rhs) {
+    lhs = Find(lhs);
+    rhs = Find(rhs);
+    if (lhs == rhs) {
+      return false;
+    }
+    if (parent_[lhs] < parent_[rhs]) {
+      std::swap(lhs, rhs);
+    }
+    // Sizes can't overflow into the root bit since Size() < kRootBit
+    parent_[lhs] += parent_[rhs] & ~kRootBit;
+    parent_[rhs] = lhs;
+    component_count_ -= 1;
+    return true;
+  }
+
+  bool AreSame(Index lhs, Index rhs) { return Find(lhs) == Find(rhs); }
+
+ private:
+  static constexpr Index kRootBit = Index(1)
+                                    << (std::numeric_limits<Index>::digits - 1);
+
+  static bool IsRoot(Index slot) { return (slot & kRootBit) != 0; }
+
+  std::vector<Index> parent_;
+  size_t component_count_ = 0;
+};
+
+}  // namespace Aads
+
+#endif  // COMPACT_DSU_HPP
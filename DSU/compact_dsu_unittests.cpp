@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "DSU/compact_dsu.hpp"
+#include "DSU/dsu.hpp"
+#include "GraphGenerators/graph_generators.hpp"
+
+TEST(CompactDSUTest, Basic) {
+  Aads::CompactDSU<> dsu(5);
+  EXPECT_EQ(dsu.ComponentCount(), 5);
+  EXPECT_EQ(dsu.ComponentSize(3), 1);
+
+  EXPECT_TRUE(dsu.Unite(0, 1));
+  EXPECT_TRUE(dsu.Unite(2, 1));
+  EXPECT_FALSE(dsu.Unite(0, 2));
+  EXPECT_TRUE(dsu.AreSame(0, 2));
+  EXPECT_FALSE(dsu.AreSame(0, 3));
+  EXPECT_EQ(dsu.ComponentCount(), 3);
+  EXPECT_EQ(dsu.ComponentSize(2), 3);
+  EXPECT_EQ(dsu.ComponentSize(4), 1);
+}
+
+TEST(CompactDSUTest, LongChainDoesNotRecurse) {
+  const uint32_t size = 2'000'000;
+  Aads::CompactDSU<> dsu(size);
+  for (uint32_t i = 0; i + 1 < size; ++i) {
+    dsu.Unite(i + 1, i);
+  }
+
+  EXPECT_EQ(dsu.ComponentCount(), 1);
+  EXPECT_EQ(dsu.ComponentSize(0), size);
+  EXPECT_TRUE(dsu.AreSame(0, size - 1));
+}
+
+TEST(CompactDSUTest, Grow) {
+  Aads::CompactDSU<> dsu;
+  dsu.Reserve(10);
+  EXPECT_EQ(dsu.Size(), 0);
+  EXPECT_EQ(dsu.ComponentCount(), 0);
+
+  EXPECT_EQ(dsu.Grow(3), 0);
+  dsu.Unite(0, 2);
+  EXPECT_EQ(dsu.Grow(), 3);
+  dsu.Unite(3, 0);
+
+  EXPECT_EQ(dsu.Size(), 4);
+  EXPECT_EQ(dsu.ComponentCount(), 2);
+  EXPECT_EQ(dsu.ComponentSize(2), 3);
+  EXPECT_FALSE(dsu.AreSame(1, 3));
+}
+
+TEST(CompactDSUTest, SameAsDSU) {
+  const size_t size = 5'000;
+  Aads::GeneratedGraph graph = Aads::ErdosRenyi(size, size * 3 / 4, 9);
+  Aads::CompactDSU<uint64_t> dsu(size);
+  Aads::DSU expected(size);
+  std::vector<size_t> sizes(size, 1);
+
+  for (const Aads::GeneratedEdge& edge : graph.edges) {
+    bool merged = not expected.AreSame(edge.from, edge.to);
+    if (merged) {
+      size_t total = sizes[expected.Find(edge.from)] +
+                     sizes[expected.Find(edge.to)];
+      expected.Unite(edge.from, edge.to);
+      sizes[expected.Find(edge.from)] = total;
+    }
+    EXPECT_EQ(dsu.Unite(edge.from, edge.to), merged);
+    EXPECT_EQ(dsu.ComponentSize(edge.to), sizes[expected.Find(edge.to)]);
+  }
+
+  for (size_t i = 0; i + 1 < size; ++i) {
+    EXPECT_EQ(dsu.AreSame(i, i + 1), expected.AreSame(i, i + 1));
+  }
+}
@@ -0,0 +1,97 @@
+#ifndef CONCURRENT_DSU_HPP
+#define CONCURRENT_DSU_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Aads {
+
+// Lock-free DSU: every method may be called from many threads at once.
+// A root is linked under the other root by one CAS on its parent, so a
+// concurrent link of the same root makes the CAS fail and the Unite retries.
+// Roots are linked by a fixed pseudo-random priority, so parents always have
+// higher priority and trees stay shallow in expectation. Find does path
+// splitting with CAS, which never breaks the forest
+class ConcurrentDSU {
+ public:
+  explicit ConcurrentDSU(size_t size) : parent_(size), count_(size) {
+    assert(size <= std::numeric_limits<uint32_t>::max());
+    for (size_t i = 0; i < size; ++i) {
+      parent_[i].store(i, std::memory_order_relaxed);
+    }
+  }
+
+  size_t Size() const { return parent_.size(); }
+
+  uint32_t Find(uint32_t idx) {
+    while (true) {
+      uint32_t parent = parent_[idx].load(std::memory_order_acquire);
+      uint32_t grandparent = parent_[parent].load(std::memory_order_acquire);
+      if (parent == grandparent) {
+        return parent;
+      }
+      // Path splitting: may fail if another thread changed the link, which
+      // only means the path is already shorter
+      parent_[idx].compare_exchange_weak(parent, grandparent,
+                                         std::memory_order_acq_rel);
+      idx = parent;
+    }
+  }
+
+  // Returns true if lhs and rhs were in different sets
+  bool Unite(uint32_t lhs, uint32_t rhs) {
+    while (true) {
+      lhs = Find(lhs);
+      rhs = Find(rhs);
+      if (lhs == rhs) {
+        return false;
+      }
+      if (Priority(lhs) > Priority(rhs)) {
+        std::swap(lhs, rhs);
+      }
+      // Fails if lhs stopped being a root since Find
+      uint32_t expected = lhs;
+      if (parent_[lhs].compare_exchange_strong(expected, rhs,
+                                               std::memory_order_acq_rel)) {
+        count_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+      }
+    }
+  }
+
+  bool AreSame(uint32_t lhs, uint32_t rhs) {
+    while (true) {
+      lhs = Find(lhs);
+      rhs = Find(rhs);
+      if (lhs == rhs) {
+        return true;
+      }
+      // If lhs is still a root, the sets were different at this moment
+      if (parent_[lhs].load(std::memory_order_acquire) == lhs) {
+        return false;
+      }
+    }
+  }
+
+  // Exact once all concurrent Unite calls have returned
+  size_t ComponentCount() const {
+    return count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // Multiplication by an odd constant is a bijection on uint32_t, so
+  // priorities are distinct
+  static uint32_t Priority(uint32_t idx) { return idx * 0x9E3779B1U; }
+
+  std::vector<std::atomic<uint32_t>> parent_;
+  std::atomic<size_t> count_;
+};
+
+}  // namespace Aads
+
+#endif  // CONCURRENT_DSU_HPP
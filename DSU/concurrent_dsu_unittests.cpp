@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "DSU/concurrent_dsu.hpp"
+#include "DSU/dsu.hpp"
+#include "GraphGenerators/graph_generators.hpp"
+
+namespace {
+
+template <typename Func>
+void RunThreads(size_t threads, Func func) {
+  std::vector<std::thread> workers;
+  for (size_t thread = 0; thread < threads; ++thread) {
+    workers.emplace_back(func, thread);
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+}
+
+}  // namespace
+
+TEST(ConcurrentDSUTest, SingleThread) {
+  Aads::ConcurrentDSU dsu(5);
+  EXPECT_EQ(dsu.ComponentCount(), 5);
+
+  EXPECT_TRUE(dsu.Unite(0, 1));
+  EXPECT_TRUE(dsu.Unite(3, 1));
+  EXPECT_FALSE(dsu.Unite(0, 3));
+  EXPECT_TRUE(dsu.AreSame(0, 3));
+  EXPECT_FALSE(dsu.AreSame(0, 2));
+  EXPECT_EQ(dsu.Find(0), dsu.Find(3));
+  EXPECT_EQ(dsu.Find(4), 4);
+  EXPECT_EQ(dsu.ComponentCount(), 3);
+}
+
+TEST(ConcurrentDSUTest, LongChain) {
+  const size_t size = 100'000;
+  Aads::ConcurrentDSU dsu(size);
+  for (uint32_t i = 0; i + 1 < size; ++i) {
+    dsu.Unite(i, i + 1);
+  }
+
+  EXPECT_EQ(dsu.ComponentCount(), 1);
+  EXPECT_TRUE(dsu.AreSame(0, size - 1));
+}
+
+TEST(ConcurrentDSUTest, ParallelUniteSameAsSequential) {
+  const size_t size = 20'000;
+  const size_t threads = 8;
+  Aads::GeneratedGraph graph = Aads::ErdosRenyi(size, size * 3 / 4, 3);
+  Aads::ConcurrentDSU dsu(size);
+
+  RunThreads(threads, [&](size_t thread) {
+    for (size_t i = thread; i < graph.edges.size(); i += threads) {
+      dsu.Unite(graph.edges[i].from, graph.edges[i].to);
+    }
+  });
+
+  Aads::DSU expected(size);
+  size_t components = size;
+  for (const Aads::GeneratedEdge& edge : graph.edges) {
+    if (not expected.AreSame(edge.from, edge.to)) {
+      expected.Unite(edge.from, edge.to);
+      components -= 1;
+    }
+  }
+
+  EXPECT_EQ(dsu.ComponentCount(), components);
+  for (uint32_t i = 0; i < size; ++i) {
+    uint32_t other = (i * 7919ULL) % size;
+    EXPECT_EQ(dsu.AreSame(i, other), expected.AreSame(i, other));
+  }
+}
+
+TEST(ConcurrentDSUTest, QueriesDuringUnites) {
+  const size_t size = 10'000;
+  Aads::ConcurrentDSU dsu(size);
+
+  // Even and odd elements form two chains that never meet
+  RunThreads(4, [&](size_t thread) {
+    for (uint32_t i = thread; i + 2 < size; i += 4) {
+      dsu.Unite(i, i + 2);
+      EXPECT_FALSE(dsu.AreSame(i, i + 1));
+    }
+  });
+
+  EXPECT_EQ(dsu.ComponentCount(), 2);
+  EXPECT_TRUE(dsu.AreSame(0, size - 2));
+  EXPECT_TRUE(dsu.AreSame(1, size - 1));
+  EXPECT_FALSE(dsu.AreSame(0, 1));
+}
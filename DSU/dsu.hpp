@@ -1,3 +1,7 @@
+#ifndef DSU_HPP
+#define DSU_HPP
+
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
@@ -12,8 +16,8 @@ class DSU {
   }
 
   void Unite(size_t lhs, size_t rhs) {
-    int lhs_anc = Find(lhs);
-    int rhs_anc = Find(rhs);
+    size_t lhs_anc = Find(lhs);
+    size_t rhs_anc = Find(rhs);
 
     if (lhs_anc == rhs_anc) {
       return;
@@ -27,7 +31,6 @@ class DSU {
 
   bool AreSame(size_t lhs, size_t rhs) { return Find(lhs) == Find(rhs); }
 
- private:
   size_t Find(size_t idx) {
     if (ancestors_[idx] != idx) {
       ancestors_[idx] = Find(ancestors_[idx]);
@@ -35,8 +38,11 @@ class DSU {
     return ancestors_[idx];
   }
 
+ private:
   std::vector<size_t> ancestors_;
   std::vector<size_t> rank_;
 };
 
 }  // namespace Aads
+
+#endif  // DSU_HPP
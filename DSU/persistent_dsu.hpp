@@ -0,0 +1,109 @@
+#ifndef PERSISTENT_DSU_HPP
+#define PERSISTENT_DSU_HPP
+
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "PersistantArray/persistant_array.hpp"
+
+namespace Aads {
+
+// Fully persistent DSU: every Unite makes a new version from any existing
+// one, and all versions stay queryable. Parents and ranks live in
+// PersistentArray, so a version costs O(log n) new nodes instead of a copy
+// of the forest. Union by rank without path compression, since compression
+// would write to old versions
+class PersistentDSU {
+ public:
+  explicit PersistentDSU(size_t size)
+      : parent_(MakeArray(Iota(size))),
+        rank_(MakeArray(std::vector<size_t>(size))) {
+    versions_.push_back({0, 0, size});
+  }
+
+  PersistentDSU(const PersistentDSU&) = delete;
+  PersistentDSU& operator=(const PersistentDSU&) = delete;
+
+  // Version 0 has every element in its own set
+  size_t Versions() const { return versions_.size(); }
+  size_t Size() const { return parent_.Size(); }
+
+  size_t Find(size_t version, size_t idx) const {
+    size_t parent_version = versions_[version].parent_version;
+    while (true) {
+      size_t parent = parent_.Get(parent_version, idx);
+      if (parent == idx) {
+        return idx;
+      }
+      idx = parent;
+    }
+  }
+
+  bool AreSame(size_t version, size_t lhs, size_t rhs) const {
+    return Find(version, lhs) == Find(version, rhs);
+  }
+
+  size_t ComponentCount(size_t version) const {
+    return versions_[version].component_count;
+  }
+
+  // Makes a new version from `version` with lhs and rhs united and returns
+  // it. A new version is made even if they were already in one set
+  size_t Unite(size_t version, size_t lhs, size_t rhs) {
+    Version res = versions_[version];
+    lhs = Find(version, lhs);
+    rhs = Find(version, rhs);
+
+    if (lhs != rhs) {
+      size_t lhs_rank = rank_.Get(res.rank_version, lhs);
+      size_t rhs_rank = rank_.Get(res.rank_version, rhs);
+      if (lhs_rank < rhs_rank) {
+        std::swap(lhs, rhs);
+      }
+
+      parent_.Set(res.parent_version, rhs, lhs);
+      res.parent_version = parent_.Versions() - 1;
+      if (lhs_rank == rhs_rank) {
+        rank_.Set(res.rank_version, lhs, lhs_rank + 1);
+        res.rank_version = rank_.Versions() - 1;
+      }
+      res.component_count -= 1;
+    }
+
+    versions_.push_back(res);
+    return versions_.size() - 1;
+  }
+
+  // Unites in the latest version
+  size_t Unite(size_t lhs, size_t rhs) {
+    return Unite(Versions() - 1, lhs, rhs);
+  }
+
+ private:
+  struct Version {
+    size_t parent_version;
+    size_t rank_version;
+    size_t component_count;
+  };
+
+  static std::vector<size_t> Iota(size_t size) {
+    std::vector<size_t> res(size);
+    std::iota(res.begin(), res.end(), 0);
+    return res;
+  }
+
+  // Returned as a prvalue, so the array is never copied
+  static PersistentArray<size_t> MakeArray(const std::vector<size_t>& values) {
+    return PersistentArray<size_t>(values.begin(), values.end());
+  }
+
+  PersistentArray<size_t> parent_;
+  PersistentArray<size_t> rank_;
+  std::vector<Version> versions_;
+};
+
+}  // namespace Aads
+
+#endif  // PERSISTENT_DSU_HPP
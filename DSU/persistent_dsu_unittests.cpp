@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "DSU/persistent_dsu.hpp"
+#include "DSU/rollback_dsu.hpp"
+
+TEST(PersistentDSUTest, Versions) {
+  Aads::PersistentDSU dsu(4);
+  EXPECT_EQ(dsu.Versions(), 1);
+
+  size_t first = dsu.Unite(0, 1);
+  size_t second = dsu.Unite(2, 3);
+  size_t third = dsu.Unite(1, 3);
+  EXPECT_EQ(first, 1);
+  EXPECT_EQ(third, 3);
+
+  EXPECT_FALSE(dsu.AreSame(0, 0, 1));
+  EXPECT_TRUE(dsu.AreSame(first, 0, 1));
+  EXPECT_FALSE(dsu.AreSame(second, 0, 3));
+  EXPECT_TRUE(dsu.AreSame(third, 0, 3));
+  EXPECT_EQ(dsu.ComponentCount(0), 4);
+  EXPECT_EQ(dsu.ComponentCount(second), 2);
+  EXPECT_EQ(dsu.ComponentCount(third), 1);
+}
+
+TEST(PersistentDSUTest, Branching) {
+  Aads::PersistentDSU dsu(3);
+  size_t base = dsu.Unite(0, 1);
+  size_t left = dsu.Unite(base, 1, 2);
+  size_t right = dsu.Unite(base, 0, 0);
+
+  EXPECT_TRUE(dsu.AreSame(left, 0, 2));
+  EXPECT_FALSE(dsu.AreSame(right, 0, 2));
+  EXPECT_EQ(dsu.ComponentCount(right), 2);
+  EXPECT_FALSE(dsu.AreSame(base, 1, 2));
+}
+
+TEST(PersistentDSUTest, SingleElement) {
+  Aads::PersistentDSU dsu(1);
+  size_t version = dsu.Unite(0, 0);
+  EXPECT_TRUE(dsu.AreSame(version, 0, 0));
+  EXPECT_EQ(dsu.Find(version, 0), 0);
+  EXPECT_EQ(dsu.ComponentCount(version), 1);
+}
+
+TEST(PersistentDSUTest, EveryVersionSameAsReplay) {
+  const size_t size = 60;
+  std::mt19937 rnd(3);
+  Aads::PersistentDSU dsu(size);
+  std::vector<std::pair<size_t, size_t>> unions;
+
+  for (int step = 0; step < 200; ++step) {
+    size_t lhs = rnd() % size;
+    size_t rhs = rnd() % size;
+    dsu.Unite(lhs, rhs);
+    unions.push_back({lhs, rhs});
+  }
+
+  Aads::RollbackDSU expected(size);
+  for (size_t version = 0; version < dsu.Versions(); ++version) {
+    if (version > 0) {
+      expected.Unite(unions[version - 1].first, unions[version - 1].second);
+    }
+    ASSERT_EQ(dsu.ComponentCount(version), expected.ComponentCount());
+    for (size_t i = 0; i + 1 < size; ++i) {
+      EXPECT_EQ(dsu.AreSame(version, i, i + 1), expected.AreSame(i, i + 1));
+    }
+  }
+}
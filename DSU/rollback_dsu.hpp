@@ -0,0 +1,84 @@
+#ifndef ROLLBACK_DSU_HPP
+#define ROLLBACK_DSU_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Aads {
+
+// DSU whose unions can be undone in reverse order. Union by rank without path
+// compression, so every Unite changes O(1) slots and Find is O(log n)
+class RollbackDSU {
+ public:
+  explicit RollbackDSU(size_t size)
+      : ancestors_(size), rank_(size), component_count_(size) {
+    for (size_t i = 0; i < size; ++i) {
+      ancestors_[i] = i;
+    }
+  }
+
+  size_t Find(size_t idx) const {
+    while (ancestors_[idx] != idx) {
+      idx = ancestors_[idx];
+    }
+    return idx;
+  }
+
+  // Returns true if lhs and rhs were in different sets
+  bool Unite(size_t lhs, size_t rhs) {
+    lhs = Find(lhs);
+    rhs = Find(rhs);
+    if (lhs == rhs) {
+      return false;
+    }
+    if (rank_[lhs] < rank_[rhs]) {
+      std::swap(lhs, rhs);
+    }
+
+    bool rank_grew = rank_[lhs] == rank_[rhs];
+    history_.push_back({rhs, rank_grew});
+    rank_[lhs] += rank_grew ? 1 : 0;
+    ancestors_[rhs] = lhs;
+    component_count_ -= 1;
+    return true;
+  }
+
+  bool AreSame(size_t lhs, size_t rhs) const {
+    return Find(lhs) == Find(rhs);
+  }
+
+  size_t ComponentCount() const { return component_count_; }
+
+  // State to return to with Rollback
+  size_t Snapshot() const { return history_.size(); }
+
+  // Undoes all unions made after the snapshot was taken
+  void Rollback(size_t snapshot) {
+    while (history_.size() > snapshot) {
+      auto [child, rank_grew] = history_.back();
+      history_.pop_back();
+      size_t root = ancestors_[child];
+      rank_[root] -= rank_grew ? 1 : 0;
+      ancestors_[child] = child;
+      component_count_ += 1;
+    }
+  }
+
+ private:
+  struct Change {
+    // Root that was linked under another root
+    size_t child;
+    bool rank_grew;
+  };
+
+  std::vector<size_t> ancestors_;
+  std::vector<uint8_t> rank_;
+  std::vector<Change> history_;
+  size_t component_count_;
+};
+
+}  // namespace Aads
+
+#endif  // ROLLBACK_DSU_HPP
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include "DSU/rollback_dsu.hpp"
+
+TEST(RollbackDSUTest, Basic) {
+  Aads::RollbackDSU dsu(4);
+  EXPECT_TRUE(dsu.Unite(0, 1));
+  EXPECT_FALSE(dsu.Unite(1, 0));
+  EXPECT_TRUE(dsu.AreSame(0, 1));
+  EXPECT_FALSE(dsu.AreSame(0, 2));
+  EXPECT_EQ(dsu.ComponentCount(), 3);
+}
+
+TEST(RollbackDSUTest, Rollback) {
+  Aads::RollbackDSU dsu(5);
+  dsu.Unite(0, 1);
+  size_t first = dsu.Snapshot();
+
+  dsu.Unite(2, 3);
+  dsu.Unite(1, 3);
+  size_t second = dsu.Snapshot();
+  dsu.Unite(4, 0);
+  EXPECT_EQ(dsu.ComponentCount(), 1);
+
+  dsu.Rollback(second);
+  EXPECT_TRUE(dsu.AreSame(0, 2));
+  EXPECT_FALSE(dsu.AreSame(0, 4));
+  EXPECT_EQ(dsu.ComponentCount(), 2);
+
+  dsu.Rollback(first);
+  EXPECT_TRUE(dsu.AreSame(0, 1));
+  EXPECT_FALSE(dsu.AreSame(2, 3));
+  EXPECT_EQ(dsu.ComponentCount(), 4);
+
+  dsu.Rollback(0);
+  EXPECT_FALSE(dsu.AreSame(0, 1));
+  EXPECT_EQ(dsu.ComponentCount(), 5);
+}
+
+TEST(RollbackDSUTest, RanksRestored) {
+  Aads::RollbackDSU dsu(8);
+  for (int round = 0; round < 3; ++round) {
+    size_t snapshot = dsu.Snapshot();
+    for (size_t step = 1; step < 8; step *= 2) {
+      for (size_t i = 0; i + step < 8; i += 2 * step) {
+        dsu.Unite(i, i + step);
+      }
+    }
+    EXPECT_EQ(dsu.ComponentCount(), 1);
+    dsu.Rollback(snapshot);
+    EXPECT_EQ(dsu.ComponentCount(), 8);
+  }
+  for (size_t i = 0; i < 8; ++i) {
+    EXPECT_EQ(dsu.Find(i), i);
+  }
+}
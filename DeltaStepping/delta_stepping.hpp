@@ -0,0 +1,234 @@
+#ifndef DELTA_STEPPING_HPP
+#define DELTA_STEPPING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "Dijkstra/dijkstra.hpp"
+
+namespace Aads {
+
+struct DeltaSteppingParams {
+  // Bucket width, 0 means max_weight / average_degree
+  int64_t delta = 0;
+  // 0 means std::thread::hardware_concurrency()
+  size_t threads = 0;
+};
+
+namespace {
+
+// Below this many vertices a phase runs on the calling thread, since spawning
+// threads costs more than relaxing a few edges
+constexpr size_t kParallelThreshold = 1024;
+
+class DeltaSteppingSolver {
+ public:
+  static constexpr int64_t kNoDistance = std::numeric_limits<int64_t>::max();
+
+  template <typename Graph>
+  DeltaSteppingSolver(const Graph& graph, const DeltaSteppingParams& params)
+      : threads_(params.threads),
+        offsets_(graph.CountVertices() + 1),
+        light_end_(graph.CountVertices()),
+        dist_(graph.CountVertices()),
+        mark_(graph.CountVertices()),
+        settled_in_(graph.CountVertices()) {
+    if (threads_ == 0) {
+      threads_ = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    local_.resize(threads_);
+    BuildArcs(graph, params.delta);
+  }
+
+  void Run(uint32_t source) {
+    for (std::atomic<int64_t>& dist : dist_) {
+      dist.store(kNoDistance, std::memory_order_relaxed);
+    }
+    std::fill(settled_in_.begin(), settled_in_.end(), 0);
+    dist_[source] = 0;
+    buckets_.assign(1, {source});
+
+    for (size_t bucket = 0; bucket < buckets_.size(); ++bucket) {
+      ProcessBucket(bucket);
+    }
+  }
+
+  int64_t GetDistance(uint32_t vertex) const {
+    return dist_[vertex].load(std::memory_order_relaxed);
+  }
+
+  size_t CountVertices() const { return dist_.size(); }
+
+ private:
+  struct Arc {
+    uint32_t to;
+    int64_t weight;
+  };
+
+  // Light arcs (weight <= delta) of every vertex are stored before the heavy
+  // ones, so both phases scan contiguous ranges
+  template <typename Graph>
+  void BuildArcs(const Graph& graph, int64_t delta) {
+    int64_t max_weight = 1;
+    for (size_t vertex = 0; vertex < CountVertices(); ++vertex) {
+      offsets_[vertex + 1] = offsets_[vertex] + graph.GetAdj(vertex).size();
+    }
+    arcs_.reserve(offsets_.back());
+
+    for (size_t vertex = 0; vertex < CountVertices(); ++vertex) {
+      for (const auto& edge : graph.GetAdj(vertex)) {
+        arcs_.push_back({static_cast<uint32_t>(edge.to), edge.weight});
+        max_weight = std::max<int64_t>(max_weight, edge.weight);
+      }
+    }
+
+    delta_ = delta;
+    if (delta_ <= 0) {
+      size_t average_degree = std::max<size_t>(
+          arcs_.size() / std::max<size_t>(CountVertices(), 1), 1);
+      delta_ = std::max<int64_t>(max_weight / average_degree, 1);
+    }
+
+    for (size_t vertex = 0; vertex < CountVertices(); ++vertex) {
+      auto heavy = std::partition(arcs_.begin() + offsets_[vertex],
+                                  arcs_.begin() + offsets_[vertex + 1],
+                                  [&](const Arc& arc) {
+                                    return arc.weight <= delta_;
+                                  });
+      light_end_[vertex] = heavy - arcs_.begin();
+    }
+  }
+
+  void ProcessBucket(size_t bucket) {
+    std::vector<uint32_t> settled;
+    std::vector<uint32_t> frontier;
+    mark_epoch_ += 1;
+
+    while (not buckets_[bucket].empty()) {
+      frontier.clear();
+      for (uint32_t vertex : buckets_[bucket]) {
+        if (BucketOf(GetDistance(vertex)) == bucket and
+            mark_[vertex] != mark_epoch_) {
+          mark_[vertex] = mark_epoch_;
+          frontier.push_back(vertex);
+        }
+      }
+      buckets_[bucket].clear();
+      for (uint32_t vertex : frontier) {
+        if (settled_in_[vertex] != bucket + 1) {
+          settled_in_[vertex] = bucket + 1;
+          settled.push_back(vertex);
+        }
+      }
+
+      RelaxAll(frontier, true);
+      // Vertices improved inside the bucket are processed again
+      mark_epoch_ += 1;
+    }
+
+    RelaxAll(settled, false);
+  }
+
+  void RelaxAll(const std::vector<uint32_t>& vertices, bool light) {
+    size_t threads = vertices.size() < kParallelThreshold ? 1 : threads_;
+    size_t chunk = (vertices.size() + threads - 1) / threads;
+
+    auto relax_chunk = [&](size_t thread) {
+      size_t end = std::min(vertices.size(), (thread + 1) * chunk);
+      for (size_t i = thread * chunk; i < end; ++i) {
+        RelaxArcs(vertices[i], light, local_[thread]);
+      }
+    };
+
+    if (threads == 1) {
+      relax_chunk(0);
+    } else {
+      std::vector<std::thread> workers;
+      for (size_t thread = 0; thread < threads; ++thread) {
+        workers.emplace_back(relax_chunk, thread);
+      }
+      for (std::thread& worker : workers) {
+        worker.join();
+      }
+    }
+
+    for (size_t thread = 0; thread < threads; ++thread) {
+      for (uint32_t vertex : local_[thread]) {
+        size_t bucket = BucketOf(GetDistance(vertex));
+        if (bucket >= buckets_.size()) {
+          buckets_.resize(bucket + 1);
+        }
+        buckets_[bucket].push_back(vertex);
+      }
+      local_[thread].clear();
+    }
+  }
+
+  void RelaxArcs(uint32_t vertex, bool light,
+                 std::vector<uint32_t>& improved) {
+    int64_t dist = GetDistance(vertex);
+    size_t begin = light ? offsets_[vertex] : light_end_[vertex];
+    size_t end = light ? light_end_[vertex] : offsets_[vertex + 1];
+
+    for (size_t i = begin; i < end; ++i) {
+      if (AtomicMin(dist_[arcs_[i].to], dist + arcs_[i].weight)) {
+        improved.push_back(arcs_[i].to);
+      }
+    }
+  }
+
+  static bool AtomicMin(std::atomic<int64_t>& target, int64_t value) {
+    int64_t current = target.load(std::memory_order_relaxed);
+    while (value < current) {
+      if (target.compare_exchange_weak(current, value,
+                                       std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  size_t BucketOf(int64_t dist) const { return dist / delta_; }
+
+  int64_t delta_ = 1;
+  size_t threads_;
+  std::vector<size_t> offsets_;
+  std::vector<size_t> light_end_;
+  std::vector<Arc> arcs_;
+  std::vector<std::atomic<int64_t>> dist_;
+  std::vector<std::vector<uint32_t>> buckets_;
+  std::vector<std::vector<uint32_t>> local_;
+  std::vector<size_t> mark_;
+  size_t mark_epoch_ = 0;
+  // bucket + 1 of the last bucket where the vertex was settled
+  std::vector<size_t> settled_in_;
+};
+
+}  // namespace
+
+// Parallel single-source shortest paths. Takes the same arguments as Dijkstra
+// and fills the visitor with distances of all reachable vertices. Vertices
+// must be 0..graph.CountVertices()-1
+template <typename Graph, typename Vertex, typename Visitor>
+void DeltaStepping(const Graph& graph, const Vertex& start, Visitor& vis,
+                   const DeltaSteppingParams& params = {}) {
+  DeltaSteppingSolver solver(graph, params);
+  solver.Run(start);
+
+  for (size_t vertex = 0; vertex < solver.CountVertices(); ++vertex) {
+    int64_t dist = solver.GetDistance(vertex);
+    if (dist != DeltaSteppingSolver::kNoDistance) {
+      vis.SetDist(vertex, dist);
+      vis.ExamineVertex(vertex);
+    }
+  }
+}
+
+}  // namespace Aads
+
+#endif  // DELTA_STEPPING_HPP
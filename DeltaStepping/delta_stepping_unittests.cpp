@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+
+#include "DeltaStepping/delta_stepping.hpp"
+#include "GraphGenerators/graph_generators.hpp"
+
+namespace {
+
+void ExpectSameAsDijkstra(const Aads::GeneratedGraph& generated, int source,
+                          const Aads::DeltaSteppingParams& params) {
+  Aads::Graph<int> graph;
+  Aads::EmitInto(graph, generated);
+
+  Aads::DijkstraVisitor<int> expected;
+  Aads::Dijkstra(graph, source, expected);
+  Aads::DijkstraVisitor<int> actual;
+  Aads::DeltaStepping(graph, source, actual, params);
+
+  for (size_t vertex = 0; vertex < graph.CountVertices(); ++vertex) {
+    ASSERT_EQ(actual.GetDistance(vertex), expected.GetDistance(vertex));
+  }
+}
+
+}  // namespace
+
+TEST(DeltaSteppingTest, SimpleGraph) {
+  Aads::Graph<int> graph;
+  graph.SetVerticesCount(5);
+  graph.AddEdge(Aads::Edge<int>(0, 1, 10));
+  graph.AddEdge(Aads::Edge<int>(0, 2, 5));
+  graph.AddEdge(Aads::Edge<int>(2, 1, 3));
+  graph.AddEdge(Aads::Edge<int>(1, 3, 1));
+
+  Aads::DijkstraVisitor<int> vis;
+  Aads::DeltaStepping(graph, 0, vis, {.delta = 4});
+
+  EXPECT_EQ(vis.GetDistance(0), 0);
+  EXPECT_EQ(vis.GetDistance(1), 8);
+  EXPECT_EQ(vis.GetDistance(2), 5);
+  EXPECT_EQ(vis.GetDistance(3), 9);
+  EXPECT_EQ(vis.GetDistance(4), Aads::kInfinity);
+  EXPECT_TRUE(vis.IsProcessed(3));
+}
+
+TEST(DeltaSteppingTest, SingleNode) {
+  Aads::Graph<int> graph;
+  graph.SetVerticesCount(1);
+
+  Aads::DijkstraVisitor<int> vis;
+  Aads::DeltaStepping(graph, 0, vis);
+
+  EXPECT_EQ(vis.GetDistance(0), 0);
+}
+
+TEST(DeltaSteppingTest, DeltaValues) {
+  Aads::GeneratedGraph grid = Aads::Grid(40, 40, 5, {0.2, 0.1, 30});
+
+  for (int64_t delta : {0, 1, 7, 30, 1000}) {
+    ExpectSameAsDijkstra(grid, 17, {.delta = delta, .threads = 1});
+  }
+}
+
+TEST(DeltaSteppingTest, ZeroWeights) {
+  ExpectSameAsDijkstra(Aads::ErdosRenyi(300, 900, 2, 1), 0, {.delta = 1});
+
+  Aads::GeneratedGraph graph = Aads::LongPath(50, 1);
+  for (auto& edge : graph.edges) {
+    edge.weight = 0;
+  }
+  ExpectSameAsDijkstra(graph, 10, {.delta = 1});
+}
+
+TEST(DeltaSteppingTest, Parallel) {
+  Aads::GeneratedGraph graph = Aads::RMat(13, 8, 11, {.max_weight = 100});
+
+  ExpectSameAsDijkstra(graph, 0, {.delta = 50, .threads = 4});
+  ExpectSameAsDijkstra(graph, 3, {.delta = 1000, .threads = 8});
+  ExpectSameAsDijkstra(graph, 5, {.delta = 0, .threads = 3});
+}
@@ -24,6 +24,7 @@ class Graph {
  public:
   using VertexT = T;
   using EdgeT = Edge<T>;
+  static constexpr bool kIsDirected = false;
 
   void SetVerticesCount(size_t count) {
     vertexcount_ = std::max(count, vertexcount_);
@@ -89,7 +90,7 @@ void Dijkstra(const Graph& graph, const Vertex& start, Visitor& vis) {
 const int kInfinity = 2009000999;
 
 template <typename Vertex>
-class Visitor {
+class DijkstraVisitor {
  public:
   void ExamineVertex(const Vertex& vert) { processed_.insert(vert); }
 
@@ -0,0 +1,480 @@
+#ifndef DIJKSTRA_ENGINE_HPP
+#define DIJKSTRA_ENGINE_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include "Dijkstra/dijkstra.hpp"
+#include "IndexedHeap/indexed_heap.hpp"
+#include "PairingHeap/pairing_heap.hpp"
+
+namespace Aads {
+
+using Distance = uint64_t;
+
+constexpr Distance kUnreachable = std::numeric_limits<Distance>::max();
+
+// Immutable graph in compressed sparse rows. Vertices are 0..n-1, weights
+// are non-negative integers
+class StaticGraph {
+ public:
+  struct Arc {
+    uint32_t to;
+    uint32_t weight;
+  };
+
+  StaticGraph() = default;
+
+  StaticGraph(size_t vertex_count, const std::vector<Edge<int>>& edges,
+              bool is_directed = false)
+      : offsets_(vertex_count + 1) {
+    for (const Edge<int>& edge : edges) {
+      offsets_[edge.from + 1] += 1;
+      if (not is_directed) {
+        offsets_[edge.to + 1] += 1;
+      }
+    }
+    FinishOffsets();
+
+    std::vector<uint32_t> fill(offsets_.begin(), offsets_.end() - 1);
+    for (const Edge<int>& edge : edges) {
+      assert(edge.weight >= 0);
+      AddArc(fill, edge.from, edge.to, edge.weight);
+      if (not is_directed) {
+        AddArc(fill, edge.to, edge.from, edge.weight);
+      }
+    }
+  }
+
+  // Converts Graph of dijkstra.hpp, vertices must be 0..CountVertices()-1
+  template <typename Graph>
+  static StaticGraph FromGraph(const Graph& graph) {
+    StaticGraph res;
+    res.offsets_.assign(graph.CountVertices() + 1, 0);
+    for (size_t vertex = 0; vertex < graph.CountVertices(); ++vertex) {
+      res.offsets_[vertex + 1] = graph.GetAdj(vertex).size();
+    }
+    res.FinishOffsets();
+
+    std::vector<uint32_t> fill(res.offsets_.begin(), res.offsets_.end() - 1);
+    for (size_t vertex = 0; vertex < graph.CountVertices(); ++vertex) {
+      for (const auto& edge : graph.GetAdj(vertex)) {
+        assert(edge.weight >= 0);
+        res.AddArc(fill, vertex, edge.to, edge.weight);
+      }
+    }
+    return res;
+  }
+
+  // The same graph with every arc reversed
+  StaticGraph Reversed() const {
+    StaticGraph res;
+    if (offsets_.empty()) {
+      return res;
+    }
+    res.offsets_.assign(offsets_.size(), 0);
+    for (const Arc& arc : arcs_) {
+      res.offsets_[arc.to + 1] += 1;
+    }
+    res.FinishOffsets();
+
+    std::vector<uint32_t> fill(res.offsets_.begin(), res.offsets_.end() - 1);
+    for (size_t vertex = 0; vertex < CountVertices(); ++vertex) {
+      for (const Arc& arc : GetAdj(vertex)) {
+        res.AddArc(fill, arc.to, vertex, arc.weight);
+      }
+    }
+    return res;
+  }
+
+  size_t CountVertices() const {
+    return offsets_.empty() ? 0 : offsets_.size() - 1;
+  }
+  size_t CountArcs() const { return arcs_.size(); }
+  uint32_t MaxWeight() const { return max_weight_; }
+
+  std::span<const Arc> GetAdj(uint32_t vertex) const {
+    return std::span(arcs_.data() + offsets_[vertex],
+                     arcs_.data() + offsets_[vertex + 1]);
+  }
+
+ private:
+  void FinishOffsets() {
+    for (size_t i = 1; i < offsets_.size(); ++i) {
+      offsets_[i] += offsets_[i - 1];
+    }
+    arcs_.resize(offsets_.back());
+  }
+
+  void AddArc(std::vector<uint32_t>& fill, uint32_t from, uint32_t to,
+              uint32_t weight) {
+    arcs_[fill[from]++] = {to, weight};
+    max_weight_ = std::max(max_weight_, weight);
+  }
+
+  uint32_t max_weight_ = 0;
+  std::vector<uint32_t> offsets_;
+  std::vector<Arc> arcs_;
+};
+
+// Monotone priority queue: a pushed key must not be less than the last popped
+// one. Keys are put into buckets by the highest bit that differs from the
+// last popped key, so every entry moves at most 64 times
+class RadixHeap {
+ public:
+  struct Entry {
+    Distance key;
+    uint32_t vertex;
+  };
+
+  void Reset(const StaticGraph& graph) {
+    std::ignore = graph;
+    for (std::vector<Entry>& bucket : buckets_) {
+      bucket.clear();
+    }
+    last_ = 0;
+    size_ = 0;
+  }
+
+  bool Empty() const { return size_ == 0; }
+
+  void Push(uint32_t vertex, Distance key) {
+    assert(key >= last_);
+    buckets_[BucketOf(key)].push_back({key, vertex});
+    size_ += 1;
+  }
+
+  Entry Pop() {
+    if (buckets_[0].empty()) {
+      size_t idx = 1;
+      while (buckets_[idx].empty()) {
+        idx += 1;
+      }
+
+      last_ = std::min_element(buckets_[idx].begin(), buckets_[idx].end(),
+                               [](const Entry& lhs, const Entry& rhs) {
+                                 return lhs.key < rhs.key;
+                               })
+                  ->key;
+      for (const Entry& entry : buckets_[idx]) {
+        buckets_[BucketOf(entry.key)].push_back(entry);
+      }
+      buckets_[idx].clear();
+    }
+
+    Entry entry = buckets_[0].back();
+    buckets_[0].pop_back();
+    size_ -= 1;
+    return entry;
+  }
+
+ private:
+  static constexpr size_t kBucketsCount =
+      std::numeric_limits<Distance>::digits + 1;
+
+  size_t BucketOf(Distance key) const { return std::bit_width(key ^ last_); }
+
+  std::array<std::vector<Entry>, kBucketsCount> buckets_;
+  Distance last_ = 0;
+  size_t size_ = 0;
+};
+
+// Dial's algorithm queue: all keys in the queue lie in
+// [current, current + max_weight], so max_weight + 1 cyclic buckets suffice.
+// Best for small integer weights
+class DialQueue {
+ public:
+  using Entry = RadixHeap::Entry;
+
+  void Reset(const StaticGraph& graph) {
+    buckets_.resize(graph.MaxWeight() + 1);
+    for (std::vector<uint32_t>& bucket : buckets_) {
+      bucket.clear();
+    }
+    current_ = 0;
+    size_ = 0;
+  }
+
+  bool Empty() const { return size_ == 0; }
+
+  void Push(uint32_t vertex, Distance key) {
+    assert(key >= current_ and key - current_ < buckets_.size());
+    buckets_[key % buckets_.size()].push_back(vertex);
+    size_ += 1;
+  }
+
+  Entry Pop() {
+    while (buckets_[current_ % buckets_.size()].empty()) {
+      current_ += 1;
+    }
+
+    std::vector<uint32_t>& bucket = buckets_[current_ % buckets_.size()];
+    uint32_t vertex = bucket.back();
+    bucket.pop_back();
+    size_ -= 1;
+    return {current_, vertex};
+  }
+
+ private:
+  std::vector<std::vector<uint32_t>> buckets_;
+  Distance current_ = 0;
+  size_t size_ = 0;
+};
+
+// Decrease-key queue: every vertex has at most one entry, so the queue never
+// holds more than |V| entries and pops no stale ones. Keys needn't be monotone
+class IndexedQueue {
+ public:
+  using Entry = RadixHeap::Entry;
+
+  void Reset(const StaticGraph& graph) {
+    if (heap_.Capacity() == graph.CountVertices()) {
+      heap_.Clear();
+    } else {
+      heap_.Resize(graph.CountVertices());
+    }
+  }
+
+  bool Empty() const { return heap_.Empty(); }
+
+  void Push(uint32_t vertex, Distance key) {
+    heap_.PushOrDecrease(vertex, key);
+  }
+
+  Entry Pop() {
+    Distance key = heap_.TopKey();
+    return {key, static_cast<uint32_t>(heap_.Pop())};
+  }
+
+ private:
+  IndexedHeap<Distance> heap_;
+};
+
+// Decrease-key queue on a pairing heap: cheaper decrease-key than
+// IndexedQueue, at the cost of pointer chasing in Pop
+class PairingQueue {
+ public:
+  using Entry = RadixHeap::Entry;
+
+  void Reset(const StaticGraph& graph) {
+    while (not heap_.Empty()) {
+      handles_[heap_.Pop().vertex] = {};
+    }
+    handles_.resize(graph.CountVertices());
+  }
+
+  bool Empty() const { return heap_.Empty(); }
+
+  void Push(uint32_t vertex, Distance key) {
+    using Handle = PairingHeap<Entry, Farther>::Handle;
+    if (handles_[vertex] == Handle()) {
+      handles_[vertex] = heap_.Insert({key, vertex});
+    } else if (key < heap_.Get(handles_[vertex]).key) {
+      // Closer is greater by Farther
+      heap_.IncreaseKey(handles_[vertex], {key, vertex});
+    }
+  }
+
+  Entry Pop() {
+    Entry entry = heap_.Pop();
+    handles_[entry.vertex] = {};
+    return entry;
+  }
+
+ private:
+  struct Farther {
+    bool operator()(const Entry& lhs, const Entry& rhs) const {
+      return lhs.key > rhs.key;
+    }
+  };
+
+  PairingHeap<Entry, Farther> heap_;
+  std::vector<PairingHeap<Entry, Farther>::Handle> handles_;
+};
+
+// Flat distance array that remembers touched vertices, so it is reset in
+// O(touched) instead of O(|V|) between searches
+class SearchWorkspace {
+ public:
+  explicit SearchWorkspace(size_t vertex_count)
+      : distance_(vertex_count, kUnreachable) {}
+
+  void Reset() {
+    for (uint32_t vertex : touched_) {
+      distance_[vertex] = kUnreachable;
+    }
+    touched_.clear();
+  }
+
+  // Returns true if dist is better than the current distance
+  bool Relax(uint32_t vertex, Distance dist) {
+    if (dist >= distance_[vertex]) {
+      return false;
+    }
+    if (distance_[vertex] == kUnreachable) {
+      touched_.push_back(vertex);
+    }
+    distance_[vertex] = dist;
+    return true;
+  }
+
+  Distance GetDistance(uint32_t vertex) const { return distance_[vertex]; }
+  bool IsReached(uint32_t vertex) const {
+    return distance_[vertex] != kUnreachable;
+  }
+
+  // Reached vertices in order of discovery
+  std::span<const uint32_t> Touched() const { return touched_; }
+
+ private:
+  std::vector<Distance> distance_;
+  std::vector<uint32_t> touched_;
+};
+
+// Vertex settled by a bounded search, with its final distance
+struct SettledVertex {
+  uint32_t vertex;
+  Distance dist;
+};
+
+// Dijkstra over StaticGraph with flat distance arrays. The workspace is kept
+// between runs and only touched vertices are reset, so repeated queries don't
+// pay O(|V|) each
+template <typename Queue = RadixHeap>
+class DijkstraEngine {
+ public:
+  static constexpr uint32_t kNoTarget = std::numeric_limits<uint32_t>::max();
+
+  explicit DijkstraEngine(const StaticGraph& graph)
+      : graph_(graph), workspace_(graph.CountVertices()) {}
+
+  // Stops as soon as target is settled, if it is given
+  void Run(uint32_t source, uint32_t target = kNoTarget) {
+    Explore(source, [target](uint32_t vertex, Distance) {
+      return vertex != target;
+    });
+  }
+
+  // Calls visitor(vertex, dist) for every settled vertex in order of distance
+  // and stops as soon as it returns false. Vertices farther than radius are
+  // neither settled nor pushed
+  template <typename Visitor>
+  void Explore(uint32_t source, Visitor&& visitor,
+               Distance radius = kUnreachable) {
+    workspace_.Reset();
+    settled_count_ = 0;
+    queue_.Reset(graph_);
+    Relax(source, 0, radius);
+
+    while (not queue_.Empty()) {
+      auto [dist, vertex] = queue_.Pop();
+      // Stale entry, the vertex was reached by a shorter path since
+      if (dist != workspace_.GetDistance(vertex)) {
+        continue;
+      }
+      settled_count_ += 1;
+      if (not visitor(vertex, dist)) {
+        return;
+      }
+
+      for (StaticGraph::Arc arc : graph_.GetAdj(vertex)) {
+        Relax(arc.to, dist + arc.weight, radius);
+      }
+    }
+  }
+
+  // All vertices within radius of source in order of distance. The result is
+  // valid until the next search
+  std::span<const SettledVertex> WithinRadius(uint32_t source,
+                                              Distance radius) {
+    result_.clear();
+    Explore(
+        source,
+        [this](uint32_t vertex, Distance dist) {
+          result_.push_back({vertex, dist});
+          return true;
+        },
+        radius);
+    return result_;
+  }
+
+  // Up to count closest vertices with is_target(vertex), in order of
+  // distance. The result is valid until the next search
+  template <typename Predicate>
+  std::span<const SettledVertex> Nearest(uint32_t source, size_t count,
+                                         Predicate&& is_target,
+                                         Distance radius = kUnreachable) {
+    result_.clear();
+    if (count == 0) {
+      workspace_.Reset();
+      settled_count_ = 0;
+      return result_;
+    }
+    Explore(
+        source,
+        [&](uint32_t vertex, Distance dist) {
+          if (is_target(vertex)) {
+            result_.push_back({vertex, dist});
+          }
+          return result_.size() < count;
+        },
+        radius);
+    return result_;
+  }
+
+  // Point-to-point distance, kUnreachable if there is no path
+  Distance Query(uint32_t source, uint32_t target) {
+    Run(source, target);
+    return workspace_.GetDistance(target);
+  }
+
+  // Distances are final only for settled vertices if the search was stopped
+  Distance GetDistance(uint32_t vertex) const {
+    return workspace_.GetDistance(vertex);
+  }
+  bool IsReached(uint32_t vertex) const {
+    return workspace_.IsReached(vertex);
+  }
+
+  // Vertices reached by the last run, in order of discovery
+  std::span<const uint32_t> Reached() const { return workspace_.Touched(); }
+  size_t SettledCount() const { return settled_count_; }
+
+ private:
+  void Relax(uint32_t vertex, Distance dist, Distance radius) {
+    if (dist <= radius and workspace_.Relax(vertex, dist)) {
+      queue_.Push(vertex, dist);
+    }
+  }
+
+  const StaticGraph& graph_;
+  Queue queue_;
+  SearchWorkspace workspace_;
+  std::vector<SettledVertex> result_;
+  size_t settled_count_ = 0;
+};
+
+template <typename Queue = RadixHeap>
+std::vector<Distance> ShortestDistances(const StaticGraph& graph,
+                                        uint32_t source) {
+  DijkstraEngine<Queue> engine(graph);
+  engine.Run(source);
+
+  std::vector<Distance> res(graph.CountVertices());
+  for (size_t vertex = 0; vertex < res.size(); ++vertex) {
+    res[vertex] = engine.GetDistance(vertex);
+  }
+  return res;
+}
+
+}  // namespace Aads
+
+#endif  // DIJKSTRA_ENGINE_HPP
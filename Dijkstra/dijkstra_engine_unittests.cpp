@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "Dijkstra/dijkstra_engine.hpp"
+#include "GraphGenerators/graph_generators.hpp"
+
+namespace {
+
+Aads::Graph<int> Generated(const Aads::GeneratedGraph& generated) {
+  Aads::Graph<int> graph;
+  Aads::EmitInto(graph, generated);
+  return graph;
+}
+
+template <typename Queue>
+void ExpectSameAsDijkstra(const Aads::Graph<int>& graph, int source) {
+  Aads::DijkstraVisitor<int> vis;
+  Aads::Dijkstra(graph, source, vis);
+
+  Aads::StaticGraph static_graph = Aads::StaticGraph::FromGraph(graph);
+  std::vector<Aads::Distance> dist =
+      Aads::ShortestDistances<Queue>(static_graph, source);
+
+  ASSERT_EQ(dist.size(), graph.CountVertices());
+  for (size_t vertex = 0; vertex < dist.size(); ++vertex) {
+    if (vis.GetDistance(vertex) == Aads::kInfinity) {
+      EXPECT_EQ(dist[vertex], Aads::kUnreachable);
+    } else {
+      EXPECT_EQ(dist[vertex], vis.GetDistance(vertex));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(DijkstraEngineTest, StaticGraph) {
+  std::vector<Aads::Edge<int>> edges = {{0, 1, 4}, {1, 2, 7}, {0, 2, 1}};
+  Aads::StaticGraph graph(4, edges);
+
+  EXPECT_EQ(graph.CountVertices(), 4);
+  EXPECT_EQ(graph.CountArcs(), 6);
+  EXPECT_EQ(graph.MaxWeight(), 7);
+  EXPECT_EQ(graph.GetAdj(0).size(), 2);
+  EXPECT_EQ(graph.GetAdj(3).size(), 0);
+
+  Aads::StaticGraph directed(4, edges, true);
+  EXPECT_EQ(directed.CountArcs(), 3);
+  EXPECT_EQ(directed.GetAdj(2).size(), 0);
+}
+
+TEST(DijkstraEngineTest, SimpleGraph) {
+  Aads::StaticGraph graph(
+      5, {{0, 1, 10}, {0, 2, 5}, {2, 1, 3}, {1, 3, 1}, {3, 3, 2}});
+
+  for (auto dist : {Aads::ShortestDistances<Aads::RadixHeap>(graph, 0),
+                    Aads::ShortestDistances<Aads::DialQueue>(graph, 0),
+                    Aads::ShortestDistances<Aads::IndexedQueue>(graph, 0)}) {
+    EXPECT_EQ(dist, std::vector<Aads::Distance>(
+                        {0, 8, 5, 9, Aads::kUnreachable}));
+  }
+}
+
+TEST(DijkstraEngineTest, ZeroWeights) {
+  Aads::StaticGraph graph(4, {{0, 1, 0}, {1, 2, 0}, {2, 3, 0}});
+
+  EXPECT_EQ(Aads::ShortestDistances<Aads::DialQueue>(graph, 3),
+            std::vector<Aads::Distance>({0, 0, 0, 0}));
+  EXPECT_EQ(Aads::ShortestDistances<Aads::RadixHeap>(graph, 3),
+            std::vector<Aads::Distance>({0, 0, 0, 0}));
+}
+
+TEST(DijkstraEngineTest, SameAsDijkstraOnGrid) {
+  Aads::Graph<int> graph = Generated(Aads::Grid(30, 30, 1, {0.3, 0.1, 20}));
+
+  ExpectSameAsDijkstra<Aads::RadixHeap>(graph, 0);
+  ExpectSameAsDijkstra<Aads::DialQueue>(graph, 0);
+  ExpectSameAsDijkstra<Aads::IndexedQueue>(graph, 0);
+  ExpectSameAsDijkstra<Aads::PairingQueue>(graph, 0);
+  ExpectSameAsDijkstra<Aads::RadixHeap>(graph, 455);
+}
+
+TEST(DijkstraEngineTest, SameAsDijkstraLargeWeights) {
+  Aads::Graph<int> graph =
+      Generated(Aads::ErdosRenyi(500, 2000, 3, 1'000'000));
+
+  ExpectSameAsDijkstra<Aads::RadixHeap>(graph, 7);
+  ExpectSameAsDijkstra<Aads::DialQueue>(graph, 7);
+  ExpectSameAsDijkstra<Aads::IndexedQueue>(graph, 7);
+  ExpectSameAsDijkstra<Aads::PairingQueue>(graph, 7);
+}
+
+TEST(DijkstraEngineTest, WorkspaceReuse) {
+  Aads::StaticGraph graph(6, {{0, 1, 1}, {1, 2, 1}, {3, 4, 1}});
+  Aads::DijkstraEngine<Aads::IndexedQueue> engine(graph);
+
+  engine.Run(0);
+  EXPECT_EQ(engine.GetDistance(2), 2);
+  EXPECT_EQ(engine.Reached().size(), 3);
+  EXPECT_EQ(engine.SettledCount(), 3);
+
+  engine.Run(4);
+  EXPECT_FALSE(engine.IsReached(0));
+  EXPECT_FALSE(engine.IsReached(2));
+  EXPECT_EQ(engine.GetDistance(3), 1);
+  EXPECT_EQ(engine.Reached().size(), 2);
+}
+
+TEST(DijkstraEngineTest, WithinRadius) {
+  Aads::Graph<int> generated =
+      Generated(Aads::Grid(20, 20, 2, {0.2, 0.1, 10}));
+  Aads::StaticGraph graph = Aads::StaticGraph::FromGraph(generated);
+  std::vector<Aads::Distance> dist = Aads::ShortestDistances(graph, 210);
+  Aads::DijkstraEngine<> engine(graph);
+
+  auto settled = engine.WithinRadius(210, 25);
+  size_t expected = std::count_if(dist.begin(), dist.end(),
+                                  [](Aads::Distance d) { return d <= 25; });
+  EXPECT_EQ(settled.size(), expected);
+  EXPECT_EQ(engine.SettledCount(), expected);
+  for (size_t i = 0; i < settled.size(); ++i) {
+    EXPECT_EQ(settled[i].dist, dist[settled[i].vertex]);
+    if (i > 0) {
+      EXPECT_LE(settled[i - 1].dist, settled[i].dist);
+    }
+  }
+  for (uint32_t vertex : engine.Reached()) {
+    EXPECT_LE(engine.GetDistance(vertex), 25);
+  }
+}
+
+TEST(DijkstraEngineTest, Nearest) {
+  Aads::StaticGraph graph(
+      6, {{0, 1, 1}, {1, 2, 1}, {2, 3, 1}, {3, 4, 1}, {4, 5, 1}});
+  Aads::DijkstraEngine<> engine(graph);
+  auto is_odd = [](uint32_t vertex) { return vertex % 2 == 1; };
+
+  auto nearest = engine.Nearest(2, 2, is_odd);
+  ASSERT_EQ(nearest.size(), 2);
+  EXPECT_EQ(nearest[0].dist, 1);
+  EXPECT_EQ(nearest[1].dist, 1);
+  EXPECT_LE(engine.SettledCount(), 4);
+
+  nearest = engine.Nearest(0, 5, is_odd);
+  ASSERT_EQ(nearest.size(), 3);
+  EXPECT_EQ(nearest[2].vertex, 5);
+  EXPECT_EQ(nearest[2].dist, 5);
+
+  EXPECT_EQ(engine.Nearest(0, 5, is_odd, 2).size(), 1);
+  EXPECT_TRUE(engine.Nearest(0, 0, is_odd).empty());
+}
+
+TEST(DijkstraEngineTest, ExploreAbort) {
+  Aads::StaticGraph graph(
+      5, {{0, 1, 1}, {1, 2, 1}, {2, 3, 1}, {3, 4, 1}}, true);
+  Aads::DijkstraEngine<Aads::DialQueue> engine(graph);
+  std::vector<uint32_t> order;
+
+  engine.Explore(0, [&](uint32_t vertex, Aads::Distance dist) {
+    order.push_back(vertex);
+    return dist < 2;
+  });
+  EXPECT_EQ(order, std::vector<uint32_t>({0, 1, 2}));
+  EXPECT_EQ(engine.SettledCount(), 3);
+  EXPECT_FALSE(engine.IsReached(4));
+}
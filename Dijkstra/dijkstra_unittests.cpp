@@ -7,7 +7,7 @@ TEST(DijkstraTest, SimpleGraph) {
   graph.AddEdge(Aads::Edge<int>(0, 1, 1));
   graph.AddEdge(Aads::Edge<int>(1, 2, 2));
 
-  Aads::Visitor<int> vis;
+  Aads::DijkstraVisitor<int> vis;
   Aads::Dijkstra(graph, 0, vis);
   
   EXPECT_EQ(vis.GetDistance(0), 0);
@@ -23,7 +23,7 @@ TEST(DijkstraTest, ShortestPath) {
   graph.AddEdge(Aads::Edge<int>(2, 1, 3));
   graph.AddEdge(Aads::Edge<int>(1, 3, 1));
 
-  Aads::Visitor<int> vis;
+  Aads::DijkstraVisitor<int> vis;
   Aads::Dijkstra(graph, 0, vis);
   
   EXPECT_EQ(vis.GetDistance(0), 0);
@@ -37,7 +37,7 @@ TEST(DijkstraTest, UnreachableNode) {
   graph.SetVerticesCount(3);
   graph.AddEdge(Aads::Edge<int>(0, 1, 1));
 
-  Aads::Visitor<int> vis;
+  Aads::DijkstraVisitor<int> vis;
   Aads::Dijkstra(graph, 0, vis);
   
   EXPECT_EQ(vis.GetDistance(0), 0);
@@ -49,7 +49,7 @@ TEST(DijkstraTest, SingleNode) {
   Aads::Graph<int> graph;
   graph.SetVerticesCount(1);
 
-  Aads::Visitor<int> vis;
+  Aads::DijkstraVisitor<int> vis;
   Aads::Dijkstra(graph, 0, vis);
   
   EXPECT_EQ(vis.GetDistance(0), 0);
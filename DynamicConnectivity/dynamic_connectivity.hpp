@@ -0,0 +1,141 @@
+#ifndef DYNAMIC_CONNECTIVITY_HPP
+#define DYNAMIC_CONNECTIVITY_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "DSU/rollback_dsu.hpp"
+
+namespace Aads {
+
+// Offline connectivity under edge insertions and deletions. Operations are
+// recorded first, then Solve answers all queries at once: every edge is alive
+// on a range of queries, the range is put into O(log q) nodes of a segment
+// tree over queries, and a DFS over the tree unites edges of a node on the
+// way down and rolls them back on the way up
+class DynamicConnectivity {
+ public:
+  explicit DynamicConnectivity(size_t vertex_count)
+      : vertex_count_(vertex_count) {}
+
+  // Parallel edges are allowed, each one is removed separately
+  void AddEdge(size_t lhs, size_t rhs) {
+    open_[Key(lhs, rhs)].push_back(queries_.size());
+  }
+
+  // The edge must be present
+  void RemoveEdge(size_t lhs, size_t rhs) {
+    auto it = open_.find(Key(lhs, rhs));
+    assert(it != open_.end() and not it->second.empty());
+    AddInterval(it->first, it->second.back(), queries_.size());
+    it->second.pop_back();
+    if (it->second.empty()) {
+      open_.erase(it);
+    }
+  }
+
+  // Return the index of the answer in Solve
+  size_t QueryConnected(size_t lhs, size_t rhs) {
+    queries_.push_back({lhs, rhs});
+    return queries_.size() - 1;
+  }
+
+  size_t QueryComponentCount() {
+    queries_.push_back({kCountQuery, kCountQuery});
+    return queries_.size() - 1;
+  }
+
+  // Answers in the order of queries: 1 or 0 for QueryConnected, the number
+  // of components for QueryComponentCount
+  std::vector<size_t> Solve() const {
+    std::vector<size_t> answers(queries_.size());
+    if (queries_.empty()) {
+      return answers;
+    }
+
+    std::vector<std::vector<Edge>> tree(4 * queries_.size());
+    for (const Interval& interval : intervals_) {
+      Insert(tree, 1, 0, queries_.size(), interval);
+    }
+    // Edges that are never removed live until the last query
+    for (const auto& [edge, starts] : open_) {
+      for (size_t start : starts) {
+        Insert(tree, 1, 0, queries_.size(), {edge, start, queries_.size()});
+      }
+    }
+
+    RollbackDSU dsu(vertex_count_);
+    Dfs(tree, dsu, 1, 0, queries_.size(), answers);
+    return answers;
+  }
+
+ private:
+  static constexpr size_t kCountQuery = static_cast<size_t>(-1);
+
+  using Edge = std::pair<size_t, size_t>;
+
+  // Edge is alive for queries [begin, end)
+  struct Interval {
+    Edge edge;
+    size_t begin;
+    size_t end;
+  };
+
+  static Edge Key(size_t lhs, size_t rhs) {
+    return lhs < rhs ? Edge{lhs, rhs} : Edge{rhs, lhs};
+  }
+
+  void AddInterval(const Edge& edge, size_t begin, size_t end) {
+    if (begin < end) {
+      intervals_.push_back({edge, begin, end});
+    }
+  }
+
+  static void Insert(std::vector<std::vector<Edge>>& tree, size_t node,
+                     size_t lo, size_t hi, const Interval& interval) {
+    if (interval.end <= lo or hi <= interval.begin) {
+      return;
+    }
+    if (interval.begin <= lo and hi <= interval.end) {
+      tree[node].push_back(interval.edge);
+      return;
+    }
+    size_t mid = (lo + hi) / 2;
+    Insert(tree, 2 * node, lo, mid, interval);
+    Insert(tree, 2 * node + 1, mid, hi, interval);
+  }
+
+  void Dfs(const std::vector<std::vector<Edge>>& tree, RollbackDSU& dsu,
+           size_t node, size_t lo, size_t hi,
+           std::vector<size_t>& answers) const {
+    size_t snapshot = dsu.Snapshot();
+    for (auto [lhs, rhs] : tree[node]) {
+      dsu.Unite(lhs, rhs);
+    }
+
+    if (hi - lo == 1) {
+      auto [lhs, rhs] = queries_[lo];
+      answers[lo] = lhs == kCountQuery ? dsu.ComponentCount()
+                                       : (dsu.AreSame(lhs, rhs) ? 1 : 0);
+    } else {
+      size_t mid = (lo + hi) / 2;
+      Dfs(tree, dsu, 2 * node, lo, mid, answers);
+      Dfs(tree, dsu, 2 * node + 1, mid, hi, answers);
+    }
+
+    dsu.Rollback(snapshot);
+  }
+
+  size_t vertex_count_;
+  // Query times at which currently present edges were added
+  std::map<Edge, std::vector<size_t>> open_;
+  std::vector<Interval> intervals_;
+  std::vector<Edge> queries_;
+};
+
+}  // namespace Aads
+
+#endif  // DYNAMIC_CONNECTIVITY_HPP
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "DSU/rollback_dsu.hpp"
+#include "DynamicConnectivity/dynamic_connectivity.hpp"
+
+TEST(DynamicConnectivityTest, Simple) {
+  Aads::DynamicConnectivity connectivity(4);
+  connectivity.AddEdge(0, 1);
+  connectivity.AddEdge(1, 2);
+  size_t connected = connectivity.QueryConnected(0, 2);
+  size_t count = connectivity.QueryComponentCount();
+  connectivity.RemoveEdge(2, 1);
+  size_t disconnected = connectivity.QueryConnected(0, 2);
+  size_t still_connected = connectivity.QueryConnected(1, 0);
+  size_t count_after = connectivity.QueryComponentCount();
+
+  std::vector<size_t> answers = connectivity.Solve();
+  ASSERT_EQ(answers.size(), 5);
+  EXPECT_EQ(answers[connected], 1);
+  EXPECT_EQ(answers[count], 2);
+  EXPECT_EQ(answers[disconnected], 0);
+  EXPECT_EQ(answers[still_connected], 1);
+  EXPECT_EQ(answers[count_after], 3);
+}
+
+TEST(DynamicConnectivityTest, ParallelEdges) {
+  Aads::DynamicConnectivity connectivity(2);
+  connectivity.AddEdge(0, 1);
+  connectivity.AddEdge(1, 0);
+  connectivity.RemoveEdge(0, 1);
+  connectivity.QueryConnected(0, 1);
+  connectivity.RemoveEdge(0, 1);
+  connectivity.QueryConnected(0, 1);
+
+  EXPECT_EQ(connectivity.Solve(), std::vector<size_t>({1, 0}));
+}
+
+TEST(DynamicConnectivityTest, NoQueries) {
+  Aads::DynamicConnectivity connectivity(3);
+  connectivity.AddEdge(0, 1);
+  connectivity.RemoveEdge(0, 1);
+
+  EXPECT_TRUE(connectivity.Solve().empty());
+}
+
+TEST(DynamicConnectivityTest, SameAsRebuild) {
+  const size_t vertex_count = 30;
+  std::mt19937 rnd(7);
+  Aads::DynamicConnectivity connectivity(vertex_count);
+  std::vector<std::pair<size_t, size_t>> edges;
+  std::vector<size_t> expected;
+
+  for (int step = 0; step < 3000; ++step) {
+    size_t lhs = rnd() % vertex_count;
+    size_t rhs = rnd() % vertex_count;
+    switch (rnd() % 4) {
+      case 0:
+        connectivity.AddEdge(lhs, rhs);
+        edges.push_back({lhs, rhs});
+        break;
+      case 1:
+        if (not edges.empty()) {
+          size_t idx = rnd() % edges.size();
+          connectivity.RemoveEdge(edges[idx].first, edges[idx].second);
+          edges.erase(edges.begin() + idx);
+        }
+        break;
+      default:
+        Aads::RollbackDSU dsu(vertex_count);
+        for (auto [from, to] : edges) {
+          dsu.Unite(from, to);
+        }
+        if (rnd() % 2 == 0) {
+          connectivity.QueryConnected(lhs, rhs);
+          expected.push_back(dsu.AreSame(lhs, rhs) ? 1 : 0);
+        } else {
+          connectivity.QueryComponentCount();
+          expected.push_back(dsu.ComponentCount());
+        }
+    }
+  }
+
+  EXPECT_EQ(connectivity.Solve(), expected);
+}
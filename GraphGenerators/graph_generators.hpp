@@ -0,0 +1,337 @@
+#ifndef GRAPH_GENERATORS_HPP
+#define GRAPH_GENERATORS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace Aads {
+
+// SplitMix64. Unlike std distributions its output is the same on every
+// platform, so generated graphs only depend on the seed
+class GeneratorRandom {
+ public:
+  explicit GeneratorRandom(uint64_t seed) : state_(seed) {}
+
+  uint64_t operator()() {
+    uint64_t res = (state_ += 0x9E3779B97F4A7C15ULL);
+    res = (res ^ (res >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    res = (res ^ (res >> 27)) * 0x94D049BB133111EBULL;
+    return res ^ (res >> 31);
+  }
+
+  // Uniform in [0, bound), bound > 0
+  uint64_t Below(uint64_t bound) { return (*this)() % bound; }
+
+  // Uniform in [0, 1)
+  double Uniform() { return ((*this)() >> 11) * 0x1.0p-53; }
+
+  template <typename T>
+  void Shuffle(std::vector<T>& values) {
+    for (size_t i = values.size(); i > 1; --i) {
+      std::swap(values[i - 1], values[Below(i)]);
+    }
+  }
+
+ private:
+  uint64_t state_;
+};
+
+struct GeneratedEdge {
+  int from;
+  int to;
+  int weight;
+};
+
+// Undirected graphs list every edge once
+struct GeneratedGraph {
+  size_t vertex_count = 0;
+  std::vector<GeneratedEdge> edges;
+};
+
+// Left vertices are 0..left_count-1, right vertices are 0..right_count-1
+struct GeneratedBipartGraph {
+  size_t left_count = 0;
+  size_t right_count = 0;
+  std::vector<std::pair<size_t, size_t>> edges;
+};
+
+// Compressed sparse rows: neighbours of `v` are
+// targets[offsets[v]..offsets[v + 1]), with weights at the same positions
+struct GeneratedCsr {
+  std::vector<size_t> offsets;
+  std::vector<int> targets;
+  std::vector<int> weights;
+};
+
+struct RMatParams {
+  double a = 0.57;
+  double b = 0.19;
+  double c = 0.19;
+  int max_weight = 1;
+  // Randomly relabel vertices, so that hubs aren't the smallest labels
+  bool scramble = true;
+};
+
+struct GridParams {
+  // Probability of the diagonal (r, c) - (r + 1, c + 1)
+  double diagonal_probability = 0;
+  // Probability to drop each grid edge, for road-like dead ends
+  double removal_probability = 0;
+  int max_weight = 1;
+};
+
+namespace {
+
+int RandomWeight(GeneratorRandom& rnd, int max_weight) {
+  return max_weight <= 1 ? 1 : 1 + static_cast<int>(rnd.Below(max_weight));
+}
+
+std::vector<int> ShuffledLabels(size_t count, GeneratorRandom& rnd,
+                                bool shuffle) {
+  std::vector<int> labels(count);
+  std::iota(labels.begin(), labels.end(), 0);
+  if (shuffle) {
+    rnd.Shuffle(labels);
+  }
+  return labels;
+}
+
+}  // namespace
+
+// Recursive matrix (Kronecker) graph with 2^scale vertices and about
+// edge_factor * 2^scale edges. Skewed degrees like in social and web graphs.
+// Self-loops are dropped
+inline GeneratedGraph RMat(size_t scale, size_t edge_factor, uint64_t seed,
+                           const RMatParams& params = {}) {
+  GeneratorRandom rnd(seed);
+  GeneratedGraph graph{1ULL << scale, {}};
+  std::vector<int> labels =
+      ShuffledLabels(graph.vertex_count, rnd, params.scramble);
+  size_t edge_count = edge_factor * graph.vertex_count;
+  graph.edges.reserve(edge_count);
+
+  for (size_t i = 0; i < edge_count; ++i) {
+    size_t from = 0;
+    size_t to = 0;
+    for (size_t level = 0; level < scale; ++level) {
+      double quadrant = rnd.Uniform();
+      bool lower = quadrant >= params.a + params.b;
+      bool right = lower ? quadrant >= params.a + params.b + params.c
+                         : quadrant >= params.a;
+      from = from * 2 + (lower ? 1 : 0);
+      to = to * 2 + (right ? 1 : 0);
+    }
+    int weight = RandomWeight(rnd, params.max_weight);
+    if (from != to) {
+      graph.edges.push_back({labels[from], labels[to], weight});
+    }
+  }
+
+  return graph;
+}
+
+// rows x cols grid, vertex (r, c) is labeled r * cols + c
+inline GeneratedGraph Grid(size_t rows, size_t cols, uint64_t seed,
+                           const GridParams& params = {}) {
+  GeneratorRandom rnd(seed);
+  GeneratedGraph graph{rows * cols, {}};
+  auto add_edge = [&](size_t row, size_t col, size_t row2, size_t col2,
+                      double probability) {
+    if (rnd.Uniform() < probability) {
+      graph.edges.push_back({static_cast<int>(row * cols + col),
+                             static_cast<int>(row2 * cols + col2),
+                             RandomWeight(rnd, params.max_weight)});
+    }
+  };
+
+  for (size_t row = 0; row < rows; ++row) {
+    for (size_t col = 0; col < cols; ++col) {
+      if (col + 1 < cols) {
+        add_edge(row, col, row, col + 1, 1 - params.removal_probability);
+      }
+      if (row + 1 < rows) {
+        add_edge(row, col, row + 1, col, 1 - params.removal_probability);
+      }
+      if (row + 1 < rows and col + 1 < cols) {
+        add_edge(row, col, row + 1, col + 1, params.diagonal_probability);
+      }
+    }
+  }
+
+  return graph;
+}
+
+// G(n, m): edge_count edges with uniformly random distinct endpoints.
+// Multi-edges are possible
+inline GeneratedGraph ErdosRenyi(size_t vertex_count, size_t edge_count,
+                                 uint64_t seed, int max_weight = 1) {
+  GeneratorRandom rnd(seed);
+  GeneratedGraph graph{vertex_count, {}};
+  if (vertex_count < 2) {
+    return graph;
+  }
+  graph.edges.reserve(edge_count);
+
+  for (size_t i = 0; i < edge_count; ++i) {
+    size_t from = rnd.Below(vertex_count);
+    // Skip `from` without rejection sampling
+    size_t to = rnd.Below(vertex_count - 1);
+    to += to >= from ? 1 : 0;
+    graph.edges.push_back({static_cast<int>(from), static_cast<int>(to),
+                           RandomWeight(rnd, max_weight)});
+  }
+
+  return graph;
+}
+
+// Random recursive tree rooted at 0: the parent of every vertex is a uniformly
+// random vertex with a smaller label. Expected depth is O(log n)
+inline GeneratedGraph RandomTree(size_t vertex_count, uint64_t seed,
+                                 int max_weight = 1) {
+  GeneratorRandom rnd(seed);
+  GeneratedGraph graph{vertex_count, {}};
+  graph.edges.reserve(vertex_count);
+
+  for (size_t vertex = 1; vertex < vertex_count; ++vertex) {
+    graph.edges.push_back({static_cast<int>(rnd.Below(vertex)),
+                           static_cast<int>(vertex),
+                           RandomWeight(rnd, max_weight)});
+  }
+
+  return graph;
+}
+
+// Path through all vertices, the worst case for recursion depth. With
+// shuffle_labels the path visits vertices in random order
+inline GeneratedGraph LongPath(size_t vertex_count, uint64_t seed,
+                               int max_weight = 1,
+                               bool shuffle_labels = false) {
+  GeneratorRandom rnd(seed);
+  GeneratedGraph graph{vertex_count, {}};
+  std::vector<int> labels =
+      ShuffledLabels(vertex_count, rnd, shuffle_labels);
+  graph.edges.reserve(vertex_count);
+
+  for (size_t i = 0; i + 1 < vertex_count; ++i) {
+    graph.edges.push_back(
+        {labels[i], labels[i + 1], RandomWeight(rnd, max_weight)});
+  }
+
+  return graph;
+}
+
+// edge_count uniformly random left-right pairs. Multi-edges are possible
+inline GeneratedBipartGraph RandomBipartite(size_t left_count,
+                                            size_t right_count,
+                                            size_t edge_count, uint64_t seed) {
+  GeneratorRandom rnd(seed);
+  GeneratedBipartGraph graph{left_count, right_count, {}};
+  if (left_count == 0 or right_count == 0) {
+    return graph;
+  }
+  graph.edges.reserve(edge_count);
+
+  for (size_t i = 0; i < edge_count; ++i) {
+    size_t left = rnd.Below(left_count);
+    graph.edges.push_back({left, rnd.Below(right_count)});
+  }
+
+  return graph;
+}
+
+// Adjacency list as used by Bridges and CutPoints
+inline std::vector<std::vector<int>> ToAdjacencyList(
+    const GeneratedGraph& graph, bool is_directed = false) {
+  std::vector<std::vector<int>> adj(graph.vertex_count);
+
+  for (const GeneratedEdge& edge : graph.edges) {
+    adj[edge.from].push_back(edge.to);
+    if (not is_directed) {
+      adj[edge.to].push_back(edge.from);
+    }
+  }
+
+  return adj;
+}
+
+inline GeneratedCsr ToCsr(const GeneratedGraph& graph,
+                          bool is_directed = false) {
+  GeneratedCsr csr;
+  csr.offsets.assign(graph.vertex_count + 1, 0);
+
+  for (const GeneratedEdge& edge : graph.edges) {
+    csr.offsets[edge.from + 1] += 1;
+    if (not is_directed) {
+      csr.offsets[edge.to + 1] += 1;
+    }
+  }
+  std::partial_sum(csr.offsets.begin(), csr.offsets.end(),
+                   csr.offsets.begin());
+
+  std::vector<size_t> fill(csr.offsets.begin(), csr.offsets.end() - 1);
+  csr.targets.resize(csr.offsets.back());
+  csr.weights.resize(csr.offsets.back());
+  auto put = [&](int from, int to, int weight) {
+    csr.targets[fill[from]] = to;
+    csr.weights[fill[from]++] = weight;
+  };
+
+  for (const GeneratedEdge& edge : graph.edges) {
+    put(edge.from, edge.to, edge.weight);
+    if (not is_directed) {
+      put(edge.to, edge.from, edge.weight);
+    }
+  }
+
+  return csr;
+}
+
+// Edge list for Kruskal and other algorithms taking {from, to, weight}
+template <typename EdgeT>
+std::vector<EdgeT> ToEdges(const GeneratedGraph& graph) {
+  std::vector<EdgeT> edges;
+  edges.reserve(graph.edges.size());
+  for (const GeneratedEdge& edge : graph.edges) {
+    edges.push_back(EdgeT{edge.from, edge.to, edge.weight});
+  }
+  return edges;
+}
+
+// Adds all edges to a Graph of DFS/, Kosaraju/, LCA/ or Dijkstra/
+template <typename Graph>
+void EmitInto(Graph& target, const GeneratedGraph& graph) {
+  if constexpr (requires { target.SetVerticesCount(graph.vertex_count); }) {
+    target.SetVerticesCount(graph.vertex_count);
+  }
+
+  for (const GeneratedEdge& edge : graph.edges) {
+    if constexpr (requires {
+                    target.AddEdge(
+                        typename Graph::EdgeT(edge.from, edge.to, edge.weight));
+                  }) {
+      target.AddEdge(typename Graph::EdgeT(edge.from, edge.to, edge.weight));
+    } else {
+      target.AddEdge(edge.from, edge.to);
+    }
+  }
+}
+
+// Adds all vertices and edges to a bipartite graph of Khun/
+template <typename BipartGraph>
+void EmitInto(BipartGraph& target, const GeneratedBipartGraph& graph) {
+  using VertexT = typename BipartGraph::VertexT;
+
+  for (size_t left = 0; left < graph.left_count; ++left) {
+    target.AddVertexToLeft(VertexT{left, false});
+  }
+  for (auto [left, right] : graph.edges) {
+    target.AddEdge({VertexT{left, false}, VertexT{right, true}});
+  }
+}
+
+}  // namespace Aads
+
+#endif  // GRAPH_GENERATORS_HPP
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "DSU/dsu.hpp"
+#include "GraphGenerators/graph_generators.hpp"
+#include "Khun/khun.hpp"
+
+namespace {
+
+bool SameEdges(const Aads::GeneratedGraph& lhs,
+               const Aads::GeneratedGraph& rhs) {
+  return lhs.vertex_count == rhs.vertex_count and
+         std::equal(lhs.edges.begin(), lhs.edges.end(), rhs.edges.begin(),
+                    rhs.edges.end(), [](const auto& lhs, const auto& rhs) {
+                      return lhs.from == rhs.from and lhs.to == rhs.to and
+                             lhs.weight == rhs.weight;
+                    });
+}
+
+bool IsConnected(const Aads::GeneratedGraph& graph) {
+  Aads::DSU dsu(graph.vertex_count);
+  for (const auto& edge : graph.edges) {
+    dsu.Unite(edge.from, edge.to);
+  }
+  for (size_t vertex = 1; vertex < graph.vertex_count; ++vertex) {
+    if (not dsu.AreSame(0, vertex)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Minimal graph accepting weighted edges, like Graph of Dijkstra/
+struct WeightedEdge {
+  WeightedEdge(int from, int to, int weight)
+      : from(from), to(to), weight(weight) {}
+
+  int from;
+  int to;
+  int weight;
+};
+
+struct WeightedGraph {
+  using EdgeT = WeightedEdge;
+
+  void SetVerticesCount(size_t count) { vertex_count = count; }
+  void AddEdge(EdgeT edge) { edges.push_back(edge); }
+
+  size_t vertex_count = 0;
+  std::vector<EdgeT> edges;
+};
+
+struct KruskalLikeEdge {
+  int from;
+  int to;
+  int weight;
+};
+
+}  // namespace
+
+TEST(GraphGeneratorsTest, Deterministic) {
+  EXPECT_TRUE(SameEdges(Aads::RMat(8, 4, 1), Aads::RMat(8, 4, 1)));
+  EXPECT_FALSE(SameEdges(Aads::RMat(8, 4, 1), Aads::RMat(8, 4, 2)));
+  EXPECT_TRUE(SameEdges(Aads::ErdosRenyi(100, 300, 5, 10),
+                        Aads::ErdosRenyi(100, 300, 5, 10)));
+  EXPECT_TRUE(SameEdges(Aads::Grid(10, 10, 3, {0.5, 0.1, 7}),
+                        Aads::Grid(10, 10, 3, {0.5, 0.1, 7})));
+}
+
+TEST(GraphGeneratorsTest, RMat) {
+  Aads::GeneratedGraph graph = Aads::RMat(10, 8, 42);
+
+  EXPECT_EQ(graph.vertex_count, 1024);
+  EXPECT_LE(graph.edges.size(), 8 * 1024);
+  EXPECT_GT(graph.edges.size(), 7 * 1024);
+
+  std::vector<size_t> degree(graph.vertex_count);
+  for (const auto& edge : graph.edges) {
+    EXPECT_NE(edge.from, edge.to);
+    ASSERT_LT(edge.from, 1024);
+    ASSERT_LT(edge.to, 1024);
+    degree[edge.from] += 1;
+    degree[edge.to] += 1;
+  }
+  // Skewed degree distribution
+  EXPECT_GT(*std::max_element(degree.begin(), degree.end()), 10 * 16);
+}
+
+TEST(GraphGeneratorsTest, Grid) {
+  Aads::GeneratedGraph full = Aads::Grid(5, 7, 1);
+  EXPECT_EQ(full.vertex_count, 35);
+  EXPECT_EQ(full.edges.size(), 5 * 6 + 4 * 7);
+  EXPECT_TRUE(IsConnected(full));
+
+  Aads::GeneratedGraph diagonal = Aads::Grid(5, 7, 1, {1, 0, 1});
+  EXPECT_EQ(diagonal.edges.size(), 5 * 6 + 4 * 7 + 4 * 6);
+
+  Aads::GeneratedGraph road = Aads::Grid(20, 20, 1, {0, 0.2, 100});
+  EXPECT_LT(road.edges.size(), 20 * 19 * 2);
+  for (const auto& edge : road.edges) {
+    EXPECT_GE(edge.weight, 1);
+    EXPECT_LE(edge.weight, 100);
+  }
+}
+
+TEST(GraphGeneratorsTest, ErdosRenyi) {
+  Aads::GeneratedGraph graph = Aads::ErdosRenyi(50, 400, 9);
+
+  EXPECT_EQ(graph.edges.size(), 400);
+  for (const auto& edge : graph.edges) {
+    EXPECT_NE(edge.from, edge.to);
+    EXPECT_LT(edge.from, 50);
+    EXPECT_LT(edge.to, 50);
+  }
+  EXPECT_TRUE(Aads::ErdosRenyi(1, 10, 9).edges.empty());
+}
+
+TEST(GraphGeneratorsTest, TreesAndPaths) {
+  Aads::GeneratedGraph tree = Aads::RandomTree(1000, 3);
+  EXPECT_EQ(tree.edges.size(), 999);
+  EXPECT_TRUE(IsConnected(tree));
+
+  Aads::GeneratedGraph path = Aads::LongPath(1000, 3, 1, true);
+  EXPECT_EQ(path.edges.size(), 999);
+  EXPECT_TRUE(IsConnected(path));
+
+  std::vector<std::vector<int>> adj = Aads::ToAdjacencyList(path);
+  size_t ends = std::count_if(adj.begin(), adj.end(),
+                              [](const auto& adj) { return adj.size() == 1; });
+  EXPECT_EQ(ends, 2);
+}
+
+TEST(GraphGeneratorsTest, Csr) {
+  Aads::GeneratedGraph graph = Aads::ErdosRenyi(30, 100, 4, 5);
+  Aads::GeneratedCsr csr = Aads::ToCsr(graph);
+  std::vector<std::vector<int>> adj = Aads::ToAdjacencyList(graph);
+
+  ASSERT_EQ(csr.offsets.size(), 31);
+  EXPECT_EQ(csr.targets.size(), 200);
+  for (size_t vertex = 0; vertex < 30; ++vertex) {
+    std::vector<int> targets(csr.targets.begin() + csr.offsets[vertex],
+                             csr.targets.begin() + csr.offsets[vertex + 1]);
+    EXPECT_EQ(targets, adj[vertex]);
+  }
+
+  Aads::GeneratedCsr directed = Aads::ToCsr(graph, true);
+  EXPECT_EQ(directed.targets.size(), 100);
+}
+
+TEST(GraphGeneratorsTest, EmitIntoLibraryTypes) {
+  Aads::GeneratedGraph graph = Aads::RandomTree(20, 8, 10);
+
+  WeightedGraph weighted;
+  Aads::EmitInto(weighted, graph);
+  EXPECT_EQ(weighted.vertex_count, 20);
+  EXPECT_EQ(weighted.edges.size(), 19);
+
+  auto edges = Aads::ToEdges<KruskalLikeEdge>(graph);
+  ASSERT_EQ(edges.size(), 19);
+  EXPECT_EQ(edges[3].to, graph.edges[3].to);
+  EXPECT_EQ(edges[3].weight, graph.edges[3].weight);
+}
+
+TEST(GraphGeneratorsTest, Bipartite) {
+  Aads::GeneratedBipartGraph bipart = Aads::RandomBipartite(20, 30, 200, 6);
+  EXPECT_EQ(bipart.edges.size(), 200);
+  for (auto [left, right] : bipart.edges) {
+    EXPECT_LT(left, 20);
+    EXPECT_LT(right, 30);
+  }
+
+  Aads::GraphT graph;
+  Aads::EmitInto(graph, bipart);
+  EXPECT_EQ(graph.LeftPart().size(), 20);
+  EXPECT_EQ(graph.CountEdges(), 200);
+
+  auto matching =
+      Aads::FindMaxMatching<Aads::GraphT, Aads::Vertex, Aads::VertexHash>(
+          graph);
+  EXPECT_LE(matching.size(), 20);
+  EXPECT_GT(matching.size(), 15);
+}
@@ -1,18 +1,95 @@
+#ifndef HEAP_HPP
+#define HEAP_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
 #include <vector>
 
 namespace Aads {
 
-// TODO: Add custom comparator support
-// TODO: Override move-constructor and move-assign operator
-template <typename T>
+// Sift helpers over a random access range: [begin, begin + size) is a d-ary
+// heap with the greatest element by compare at begin. Heap is built on them,
+// and so are TopK, PartialSort and HeapSort of TopK/. Sifts move the element
+// into a hole, so every level costs one move instead of a swap
+template <size_t Arity, std::random_access_iterator Iter, typename Compare>
+void HeapSiftUp(Iter begin, size_t idx, Compare compare) {
+  std::iter_value_t<Iter> value = std::move(begin[idx]);
+  while (idx > 0) {
+    size_t parent = (idx - 1) / Arity;
+    if (not compare(begin[parent], value)) {
+      break;
+    }
+    begin[idx] = std::move(begin[parent]);
+    idx = parent;
+  }
+  begin[idx] = std::move(value);
+}
+
+// Compares the element with the greatest child only, d comparisons per level
+template <size_t Arity, std::random_access_iterator Iter, typename Compare>
+void HeapSiftDown(Iter begin, size_t size, size_t idx, Compare compare) {
+  std::iter_value_t<Iter> value = std::move(begin[idx]);
+  while (true) {
+    size_t first = idx * Arity + 1;
+    if (first >= size) {
+      break;
+    }
+    size_t last = std::min(first + Arity, size);
+    size_t best = first;
+    for (size_t child = first + 1; child < last; ++child) {
+      if (compare(begin[best], begin[child])) {
+        best = child;
+      }
+    }
+    if (not compare(value, begin[best])) {
+      break;
+    }
+    begin[idx] = std::move(begin[best]);
+    idx = best;
+  }
+  begin[idx] = std::move(value);
+}
+
+// Floyd's bottom-up heapify in O(size): every node after the last parent is
+// a heap already
+template <size_t Arity, std::random_access_iterator Iter, typename Compare>
+void MakeHeap(Iter begin, size_t size, Compare compare) {
+  if (size < 2) {
+    return;
+  }
+  for (size_t idx = (size - 2) / Arity + 1; idx > 0; --idx) {
+    HeapSiftDown<Arity>(begin, size, idx - 1, compare);
+  }
+}
+
+// d-ary heap. Like std::priority_queue, the top is the greatest element by
+// Compare, so the default is a max-heap. Elements are only moved, never
+// copied, so move-only types work
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
 class Heap {
+  static_assert(Arity >= 2);
+
  public:
+  explicit Heap(const Compare& compare = Compare()) : compare_(compare) {}
+
+  // Floyd's bottom-up heapify, O(n)
+  template <std::input_iterator Iter>
+  Heap(Iter begin, Iter end, const Compare& compare = Compare())
+      : compare_(compare), heap_(begin, end) {
+    Heapify();
+  }
+
   T& GetMax() { return heap_[0]; }
   const T& GetMax() const { return heap_[0]; }
 
   void Reserve(size_t size) { heap_.reserve(size); }
 
   size_t Size() const { return heap_.size(); }
+  bool Empty() const { return heap_.empty(); }
 
   void Insert(const T& new_elem) {
     heap_.push_back(new_elem);
@@ -20,7 +97,7 @@ class Heap {
   }
 
   void Insert(T&& new_elem) {
-    heap_.push_back(new_elem);
+    heap_.push_back(std::move(new_elem));
     SiftUp(heap_.size() - 1);
   }
 
@@ -30,51 +107,62 @@ class Heap {
     SiftUp(heap_.size() - 1);
   }
 
-  void ExtractMax() {
-    std::swap(heap_[0], heap_[heap_.size() - 1]);
-    heap_.pop_back();
-    SiftDown(0);
+  // Appends the range, then either sifts every new element up or rebuilds
+  // the heap in O(n), whichever is cheaper
+  template <std::input_iterator Iter>
+  void InsertMany(Iter begin, Iter end) {
+    size_t old_size = heap_.size();
+    heap_.insert(heap_.end(), begin, end);
+    size_t added = heap_.size() - old_size;
+
+    if (added * std::bit_width(heap_.size()) > heap_.size()) {
+      Heapify();
+      return;
+    }
+    for (size_t idx = old_size; idx < heap_.size(); ++idx) {
+      SiftUp(idx);
+    }
   }
 
- private:
-  void SiftUp(size_t idx) {
-    while (heap_[GetParent(idx)] < heap_[idx]) {
-      std::swap(heap_[GetParent(idx)], heap_[idx]);
-      idx = GetParent(idx);
+  // Moves all elements of other into this heap, other becomes empty. The
+  // smaller heap is inserted into the larger one
+  void Merge(Heap&& other) {
+    if (other.heap_.size() > heap_.size()) {
+      std::swap(heap_, other.heap_);
     }
+    InsertMany(std::make_move_iterator(other.heap_.begin()),
+               std::make_move_iterator(other.heap_.end()));
+    other.heap_.clear();
   }
 
-  void SiftDown(size_t idx) {
-    while (true) {
-      size_t min_child = GetLeftChild(idx);
-      size_t max_child = GetRightChild(idx);
-      if (heap_[min_child] > heap_[max_child]) {
-        std::swap(min_child, max_child);
-      }
-
-      if (heap_[max_child] > heap_[idx]) {
-        std::swap(heap_[idx], heap_[max_child]);
-        idx = max_child;
-      } else if (heap_[min_child] > heap_[idx]) {
-        std::swap(heap_[idx], heap_[min_child]);
-        idx = min_child;
-      } else {
-        break;
-      }
+  void ExtractMax() { Pop(); }
+
+  // Removes the top and returns it
+  T Pop() {
+    T res = std::move(heap_[0]);
+    if (heap_.size() > 1) {
+      heap_[0] = std::move(heap_.back());
+      heap_.pop_back();
+      SiftDown(0);
+    } else {
+      heap_.pop_back();
     }
+    return res;
   }
 
-  static size_t GetParent(size_t idx) { return idx == 0 ? 0 : (idx - 1) / 2; }
+ private:
+  void Heapify() { MakeHeap<Arity>(heap_.begin(), heap_.size(), compare_); }
 
-  size_t GetLeftChild(size_t idx) {
-    return 2 * idx + 1 < heap_.size() ? 2 * idx + 1 : idx;
-  }
+  void SiftUp(size_t idx) { HeapSiftUp<Arity>(heap_.begin(), idx, compare_); }
 
-  size_t GetRightChild(size_t idx) {
-    return 2 * idx + 2 < heap_.size() ? 2 * idx + 2 : idx;
+  void SiftDown(size_t idx) {
+    HeapSiftDown<Arity>(heap_.begin(), heap_.size(), idx, compare_);
   }
 
+  [[no_unique_address]] Compare compare_;
   std::vector<T> heap_;
 };
 
 }  // namespace Aads
+
+#endif  // HEAP_HPP
@@ -1,5 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
 #include "Heap/heap.hpp"
 
 namespace Aads {
@@ -144,4 +151,138 @@ TEST_F(HeapTest, StringHeap) {
   EXPECT_EQ("banana", string_heap.GetMax());
 }
 
+TEST(HeapCompareTest, MinHeap) {
+  Heap<int, std::greater<int>> heap;
+  for (int value : {5, 1, 4, 2, 3}) {
+    heap.Insert(value);
+  }
+
+  for (int expected = 1; expected <= 5; ++expected) {
+    EXPECT_EQ(heap.Pop(), expected);
+  }
+  EXPECT_TRUE(heap.Empty());
+}
+
+TEST(HeapCompareTest, StatefulComparator) {
+  std::vector<int> priority = {3, 1, 2};
+  auto by_priority = [&priority](int lhs, int rhs) {
+    return priority[lhs] < priority[rhs];
+  };
+  Heap<int, decltype(by_priority), 2> heap(by_priority);
+  heap.Insert(0);
+  heap.Insert(1);
+  heap.Insert(2);
+
+  EXPECT_EQ(heap.Pop(), 0);
+  EXPECT_EQ(heap.Pop(), 2);
+  EXPECT_EQ(heap.Pop(), 1);
+}
+
+TEST(HeapCompareTest, MoveOnly) {
+  auto less = [](const std::unique_ptr<int>& lhs,
+                 const std::unique_ptr<int>& rhs) { return *lhs < *rhs; };
+  Heap<std::unique_ptr<int>, decltype(less)> heap;
+  heap.Insert(std::make_unique<int>(2));
+  heap.Emplace(std::make_unique<int>(7));
+  heap.Insert(std::make_unique<int>(5));
+
+  std::unique_ptr<int> top = heap.Pop();
+  EXPECT_EQ(*top, 7);
+  EXPECT_EQ(*heap.GetMax(), 5);
+  heap.ExtractMax();
+  EXPECT_EQ(*heap.Pop(), 2);
+}
+
+template <size_t Arity>
+void CheckHeapSorts() {
+  std::mt19937 rnd(Arity);
+  Heap<int, std::less<int>, Arity> heap;
+  std::vector<int> values(5000);
+  for (int& value : values) {
+    value = rnd() % 1000;
+    heap.Insert(value);
+  }
+
+  std::sort(values.begin(), values.end(), std::greater<int>());
+  for (int value : values) {
+    ASSERT_EQ(heap.Pop(), value);
+  }
+}
+
+TEST(HeapCompareTest, Arity) {
+  CheckHeapSorts<2>();
+  CheckHeapSorts<3>();
+  CheckHeapSorts<4>();
+  CheckHeapSorts<8>();
+}
+
+TEST(HeapBulkTest, RangeConstructor) {
+  std::vector<int> values = {3, 9, 1, 7, 5, 8, 2};
+  Heap<int> heap(values.begin(), values.end());
+  EXPECT_EQ(heap.Size(), values.size());
+
+  std::sort(values.begin(), values.end(), std::greater<int>());
+  for (int value : values) {
+    EXPECT_EQ(heap.Pop(), value);
+  }
+
+  std::vector<int> empty;
+  EXPECT_TRUE(Heap<int>(empty.begin(), empty.end()).Empty());
+}
+
+TEST(HeapBulkTest, RangeConstructorMoveOnly) {
+  std::vector<std::unique_ptr<int>> values;
+  for (int value : {4, 8, 6}) {
+    values.push_back(std::make_unique<int>(value));
+  }
+  auto less = [](const std::unique_ptr<int>& lhs,
+                 const std::unique_ptr<int>& rhs) { return *lhs < *rhs; };
+
+  Heap<std::unique_ptr<int>, decltype(less), 3> heap(
+      std::make_move_iterator(values.begin()),
+      std::make_move_iterator(values.end()));
+  EXPECT_EQ(*heap.Pop(), 8);
+  EXPECT_EQ(*heap.Pop(), 6);
+}
+
+TEST(HeapBulkTest, InsertMany) {
+  std::mt19937 rnd(1);
+  std::vector<int> all;
+  Heap<int, std::greater<int>> heap;
+
+  // Both small batches (sift up) and large ones (rebuild)
+  for (size_t batch : {1000, 5, 1, 20, 3000, 0, 7}) {
+    std::vector<int> values(batch);
+    for (int& value : values) {
+      value = rnd() % 10'000;
+    }
+    heap.InsertMany(values.begin(), values.end());
+    all.insert(all.end(), values.begin(), values.end());
+    ASSERT_EQ(heap.Size(), all.size());
+  }
+
+  std::sort(all.begin(), all.end());
+  for (int value : all) {
+    ASSERT_EQ(heap.Pop(), value);
+  }
+}
+
+TEST(HeapBulkTest, Merge) {
+  std::vector<int> small = {1, 10};
+  std::vector<int> large = {2, 3, 4, 5, 6, 7};
+  Heap<int> lhs(small.begin(), small.end());
+  Heap<int> rhs(large.begin(), large.end());
+
+  lhs.Merge(std::move(rhs));
+  EXPECT_TRUE(rhs.Empty());
+  EXPECT_EQ(lhs.Size(), 8);
+  for (int value : {10, 7, 6, 5, 4, 3, 2, 1}) {
+    EXPECT_EQ(lhs.Pop(), value);
+  }
+
+  rhs.Insert(5);
+  lhs.Merge(std::move(rhs));
+  EXPECT_EQ(lhs.GetMax(), 5);
+}
+
 }  // namespace Aads
@@ -0,0 +1,163 @@
+#ifndef HOPCROFT_KARP_HPP
+#define HOPCROFT_KARP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "Khun/khun.hpp"
+
+namespace Aads {
+
+// Maximum matching of a graph with dense vertices, such as BipartiteGraph:
+// graph.CountLeft(), graph.CountRight() and graph.GetAdj(left), a random
+// access range of right vertices. Every phase finds a
+// maximal set of shortest augmenting paths by a BFS from all free left
+// vertices and DFS along the BFS layers, there are O(sqrt(V)) phases. Both
+// searches use explicit stacks, so long augmenting paths don't overflow the
+// call stack
+class HopcroftKarp {
+ public:
+  // Augments the given matching, which may be non-empty, to a maximum one
+  // and returns its size
+  template <typename Graph>
+  size_t Run(const Graph& graph, Matching& matching) {
+    matching_ = &matching;
+    layer_.resize(graph.CountLeft());
+    next_arc_.resize(graph.CountLeft());
+
+    while (BuildLayers(graph)) {
+      for (uint32_t left = 0; left < graph.CountLeft(); ++left) {
+        next_arc_[left] = 0;
+      }
+      for (uint32_t left = 0; left < graph.CountLeft(); ++left) {
+        if (matching.IsLeftFree(left)) {
+          Augment(graph, left);
+        }
+      }
+    }
+
+    matching_ = nullptr;
+    return matching.Size();
+  }
+
+ private:
+  static constexpr uint32_t kNoLayer = std::numeric_limits<uint32_t>::max();
+
+  // Layer of a left vertex is the length of the shortest alternating path to
+  // it from a free left vertex, in matched edges. Returns false if there is
+  // no augmenting path
+  template <typename Graph>
+  bool BuildLayers(const Graph& graph) {
+    queue_.clear();
+    for (uint32_t left = 0; left < graph.CountLeft(); ++left) {
+      if (matching_->IsLeftFree(left)) {
+        layer_[left] = 0;
+        queue_.push_back(left);
+      } else {
+        layer_[left] = kNoLayer;
+      }
+    }
+
+    free_layer_ = kNoLayer;
+    for (size_t head = 0; head < queue_.size(); ++head) {
+      uint32_t left = queue_[head];
+      if (layer_[left] >= free_layer_) {
+        break;
+      }
+      for (uint32_t right : graph.GetAdj(left)) {
+        uint32_t next = matching_->MatchOfRight(right);
+        if (next == Matching::kFree) {
+          free_layer_ = layer_[left] + 1;
+        } else if (layer_[next] == kNoLayer) {
+          layer_[next] = layer_[left] + 1;
+          queue_.push_back(next);
+        }
+      }
+    }
+
+    return free_layer_ != kNoLayer;
+  }
+
+  // DFS from a free left vertex along the layers. next_arc_ keeps the first
+  // arc of every vertex not tried yet in this phase, and vertices without a
+  // path to a free right vertex leave the layers
+  template <typename Graph>
+  bool Augment(const Graph& graph, uint32_t root) {
+    stack_.assign(1, root);
+
+    while (not stack_.empty()) {
+      uint32_t left = stack_.back();
+      auto adj = graph.GetAdj(left);
+      if (next_arc_[left] == adj.size()) {
+        layer_[left] = kNoLayer;
+        stack_.pop_back();
+        if (not stack_.empty()) {
+          next_arc_[stack_.back()] += 1;
+        }
+        continue;
+      }
+
+      uint32_t right = adj[next_arc_[left]];
+      uint32_t next = matching_->MatchOfRight(right);
+      if (next == Matching::kFree and layer_[left] + 1 == free_layer_) {
+        Flip(graph);
+        return true;
+      }
+      if (next != Matching::kFree and layer_[next] == layer_[left] + 1) {
+        stack_.push_back(next);
+      } else {
+        next_arc_[left] += 1;
+      }
+    }
+
+    return false;
+  }
+
+  // Every left vertex of the stack takes the right vertex of its current arc
+  template <typename Graph>
+  void Flip(const Graph& graph) {
+    for (uint32_t left : stack_) {
+      matching_->Match(left, graph.GetAdj(left)[next_arc_[left]]);
+      next_arc_[left] += 1;
+    }
+  }
+
+  Matching* matching_ = nullptr;
+  uint32_t free_layer_ = kNoLayer;
+  std::vector<uint32_t> layer_;
+  std::vector<size_t> next_arc_;
+  std::vector<uint32_t> queue_;
+  std::vector<uint32_t> stack_;
+};
+
+// Drop-in replacement of FindMaxMatching: same graph and the same result, a
+// map from right vertices to left ones, in O(E sqrt(V)) time. The graph is
+// converted to BipartiteGraph once
+template <typename BipartitionGraph, typename Vertex, typename VertexHash>
+std::unordered_map<Vertex, Vertex, VertexHash> FindMaxMatchingHopcroftKarp(
+    const BipartitionGraph& graph) {
+  std::vector<Vertex> right_vertices;
+  BipartiteGraph dense =
+      BipartiteGraph::FromGraph<BipartitionGraph, Vertex, VertexHash>(
+          graph, right_vertices);
+  Matching dense_matching(dense.CountLeft(), dense.CountRight());
+  HopcroftKarp().Run(dense, dense_matching);
+
+  std::unordered_map<Vertex, Vertex, VertexHash> matching;
+  matching.reserve(dense_matching.Size());
+  auto left_part = graph.LeftPart();
+  for (uint32_t left = 0; left < left_part.size(); ++left) {
+    if (not dense_matching.IsLeftFree(left)) {
+      matching.emplace(right_vertices[dense_matching.MatchOfLeft(left)],
+                       left_part[left]);
+    }
+  }
+  return matching;
+}
+
+}  // namespace Aads
+
+#endif  // HOPCROFT_KARP_HPP
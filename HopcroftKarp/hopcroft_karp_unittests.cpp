@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+#include "HopcroftKarp/hopcroft_karp.hpp"
+#include "Khun/khun.hpp"
+
+namespace {
+
+Aads::GraphT RandomBipartite(size_t left, size_t right, size_t edges,
+                             uint32_t seed) {
+  std::mt19937 rnd(seed);
+  Aads::GraphT graph;
+  for (size_t idx = 0; idx < left; ++idx) {
+    graph.AddVertexToLeft({idx, false});
+  }
+  for (size_t idx = 0; idx < edges; ++idx) {
+    graph.AddEdge({{rnd() % left, false}, {rnd() % right, true}});
+  }
+  return graph;
+}
+
+void ExpectValidMatching(
+    const Aads::GraphT& graph,
+    const std::unordered_map<Aads::Vertex, Aads::Vertex, Aads::VertexHash>&
+        matching) {
+  std::set<size_t> used_left;
+  for (const auto& [right, left] : matching) {
+    EXPECT_TRUE(right.is_right);
+    EXPECT_FALSE(left.is_right);
+    EXPECT_TRUE(used_left.insert(left.index).second);
+
+    bool has_edge = false;
+    for (const auto& edge : graph.GetAdj(left)) {
+      has_edge = has_edge or edge.second == right;
+    }
+    EXPECT_TRUE(has_edge);
+  }
+}
+
+}  // namespace
+
+TEST(HopcroftKarpTest, Simple) {
+  Aads::GraphT graph;
+  for (size_t idx = 0; idx < 3; ++idx) {
+    graph.AddVertexToLeft({idx, false});
+  }
+  // Greedy 0-0 blocks 1, the maximum matching is 0-1, 1-0, 2-2
+  graph.AddEdge({{0, false}, {0, true}});
+  graph.AddEdge({{0, false}, {1, true}});
+  graph.AddEdge({{1, false}, {0, true}});
+  graph.AddEdge({{2, false}, {2, true}});
+
+  auto matching =
+      Aads::FindMaxMatchingHopcroftKarp<Aads::GraphT, Aads::Vertex,
+                                        Aads::VertexHash>(graph);
+  EXPECT_EQ(matching.size(), 3);
+  EXPECT_EQ(matching.at({0, true}).index, 1);
+  EXPECT_EQ(matching.at({1, true}).index, 0);
+  ExpectValidMatching(graph, matching);
+}
+
+TEST(HopcroftKarpTest, EmptyGraph) {
+  Aads::GraphT graph;
+  EXPECT_TRUE((Aads::FindMaxMatchingHopcroftKarp<Aads::GraphT, Aads::Vertex,
+                                                 Aads::VertexHash>(graph)
+                   .empty()));
+
+  graph.AddVertexToLeft({0, false});
+  EXPECT_TRUE((Aads::FindMaxMatchingHopcroftKarp<Aads::GraphT, Aads::Vertex,
+                                                 Aads::VertexHash>(graph)
+                   .empty()));
+}
+
+TEST(HopcroftKarpTest, SameSizeAsKuhn) {
+  for (uint32_t seed = 0; seed < 10; ++seed) {
+    Aads::GraphT graph = RandomBipartite(60, 50, 50 + seed * 20, seed);
+
+    auto expected =
+        Aads::FindMaxMatching<Aads::GraphT, Aads::Vertex, Aads::VertexHash>(
+            graph);
+    auto matching =
+        Aads::FindMaxMatchingHopcroftKarp<Aads::GraphT, Aads::Vertex,
+                                          Aads::VertexHash>(graph);
+    EXPECT_EQ(matching.size(), expected.size());
+    ExpectValidMatching(graph, matching);
+  }
+}
+
+TEST(HopcroftKarpTest, SameAsKuhnOnDenseGraph) {
+  std::mt19937 rnd(11);
+  for (size_t iter = 0; iter < 10; ++iter) {
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    for (size_t idx = 0; idx < 300; ++idx) {
+      edges.emplace_back(rnd() % 100, rnd() % 120);
+    }
+    Aads::BipartiteGraph graph(100, 120, edges);
+
+    Aads::Matching expected(100, 120);
+    Aads::Matching matching(100, 120);
+    Aads::KuhnMaxMatching(graph, expected);
+    EXPECT_EQ(Aads::HopcroftKarp().Run(graph, matching), expected.Size());
+  }
+}
+
+TEST(HopcroftKarpTest, LongAugmentingPath) {
+  // The first phase matches left i with right i + 1 and leaves the last left
+  // vertex free, the only augmenting path then visits every vertex
+  const size_t size = 200'000;
+  std::vector<std::pair<uint32_t, uint32_t>> edges;
+  for (uint32_t left = 0; left < size; ++left) {
+    if (left + 1 < size) {
+      edges.emplace_back(left, left + 1);
+    }
+    edges.emplace_back(left, left);
+  }
+  Aads::BipartiteGraph graph(size, size, edges);
+  Aads::Matching matching(size, size);
+
+  EXPECT_EQ(Aads::HopcroftKarp().Run(graph, matching), size);
+  for (uint32_t left = 0; left < size; ++left) {
+    EXPECT_EQ(matching.MatchOfLeft(left), left);
+    EXPECT_EQ(matching.MatchOfRight(left), left);
+  }
+}
@@ -0,0 +1,168 @@
+#ifndef INDEXED_HEAP_HPP
+#define INDEXED_HEAP_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Aads {
+
+// Addressable d-ary heap over indices 0..capacity-1, each index holds at most
+// one key. The top is the smallest key by Compare, so with std::less it is a
+// min-heap. A position index per element allows DecreaseKey and Erase
+template <typename Key, typename Compare = std::less<Key>, size_t Arity = 4>
+class IndexedHeap {
+  static_assert(Arity >= 2);
+
+ public:
+  explicit IndexedHeap(size_t capacity = 0, const Compare& compare = Compare())
+      : compare_(compare), position_(capacity, kNotInHeap) {}
+
+  // Removes all elements and changes the range of indices
+  void Resize(size_t capacity) {
+    heap_.clear();
+    position_.assign(capacity, kNotInHeap);
+  }
+
+  // O(Size()), unlike Resize
+  void Clear() {
+    for (const Node& node : heap_) {
+      position_[node.index] = kNotInHeap;
+    }
+    heap_.clear();
+  }
+
+  size_t Capacity() const { return position_.size(); }
+  size_t Size() const { return heap_.size(); }
+  bool Empty() const { return heap_.empty(); }
+
+  bool Contains(size_t index) const {
+    return position_[index] != kNotInHeap;
+  }
+
+  const Key& GetKey(size_t index) const {
+    assert(Contains(index));
+    return heap_[position_[index]].key;
+  }
+
+  size_t Top() const { return heap_[0].index; }
+  const Key& TopKey() const { return heap_[0].key; }
+
+  void Push(size_t index, Key key) {
+    assert(not Contains(index));
+    position_[index] = heap_.size();
+    heap_.push_back({std::move(key), index});
+    SiftUp(heap_.size() - 1);
+  }
+
+  // key must not be greater than the current one
+  void DecreaseKey(size_t index, Key key) {
+    assert(not compare_(GetKey(index), key));
+    size_t pos = position_[index];
+    heap_[pos].key = std::move(key);
+    SiftUp(pos);
+  }
+
+  // Pushes index or decreases its key. Returns false if the index already
+  // has a key that is not greater
+  bool PushOrDecrease(size_t index, Key key) {
+    if (not Contains(index)) {
+      Push(index, std::move(key));
+      return true;
+    }
+    if (not compare_(key, GetKey(index))) {
+      return false;
+    }
+    DecreaseKey(index, std::move(key));
+    return true;
+  }
+
+  // Removes the top and returns its index
+  size_t Pop() {
+    size_t index = Top();
+    Erase(index);
+    return index;
+  }
+
+  void Erase(size_t index) {
+    assert(Contains(index));
+    size_t pos = position_[index];
+    position_[index] = kNotInHeap;
+    if (pos + 1 == heap_.size()) {
+      heap_.pop_back();
+      return;
+    }
+
+    heap_[pos] = std::move(heap_.back());
+    heap_.pop_back();
+    position_[heap_[pos].index] = pos;
+    if (pos > 0 and compare_(heap_[pos].key, heap_[Parent(pos)].key)) {
+      SiftUp(pos);
+    } else {
+      SiftDown(pos);
+    }
+  }
+
+ private:
+  static constexpr size_t kNotInHeap = std::numeric_limits<size_t>::max();
+
+  // Keys are stored next to their indices, so sifts don't jump to position_
+  // for comparisons
+  struct Node {
+    Key key;
+    size_t index;
+  };
+
+  static size_t Parent(size_t pos) { return (pos - 1) / Arity; }
+
+  // Moves the element into a hole instead of swapping at every level
+  void SiftUp(size_t pos) {
+    Node node = std::move(heap_[pos]);
+    while (pos > 0 and compare_(node.key, heap_[Parent(pos)].key)) {
+      Place(pos, std::move(heap_[Parent(pos)]));
+      pos = Parent(pos);
+    }
+    Place(pos, std::move(node));
+  }
+
+  void SiftDown(size_t pos) {
+    Node node = std::move(heap_[pos]);
+    while (true) {
+      size_t first = pos * Arity + 1;
+      if (first >= heap_.size()) {
+        break;
+      }
+      size_t last = std::min(first + Arity, heap_.size());
+      size_t best = first;
+      for (size_t child = first + 1; child < last; ++child) {
+        if (compare_(heap_[child].key, heap_[best].key)) {
+          best = child;
+        }
+      }
+      if (not compare_(heap_[best].key, node.key)) {
+        break;
+      }
+      Place(pos, std::move(heap_[best]));
+      pos = best;
+    }
+    Place(pos, std::move(node));
+  }
+
+  void Place(size_t pos, Node&& node) {
+    heap_[pos] = std::move(node);
+    position_[heap_[pos].index] = pos;
+  }
+
+  Compare compare_;
+  std::vector<Node> heap_;
+  // position_[index] is the position of index in heap_ or kNotInHeap
+  std::vector<size_t> position_;
+};
+
+}  // namespace Aads
+
+#endif  // INDEXED_HEAP_HPP
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IndexedHeap/indexed_heap.hpp"
+
+TEST(IndexedHeapTest, PushPop) {
+  Aads::IndexedHeap<int> heap(5);
+  EXPECT_TRUE(heap.Empty());
+
+  heap.Push(0, 30);
+  heap.Push(3, 10);
+  heap.Push(4, 20);
+  EXPECT_EQ(heap.Size(), 3);
+  EXPECT_EQ(heap.Top(), 3);
+  EXPECT_EQ(heap.TopKey(), 10);
+
+  EXPECT_EQ(heap.Pop(), 3);
+  EXPECT_EQ(heap.Pop(), 4);
+  EXPECT_EQ(heap.Pop(), 0);
+  EXPECT_TRUE(heap.Empty());
+}
+
+TEST(IndexedHeapTest, DecreaseKey) {
+  Aads::IndexedHeap<int> heap(4);
+  heap.Push(0, 10);
+  heap.Push(1, 20);
+  heap.Push(2, 30);
+
+  heap.DecreaseKey(2, 5);
+  EXPECT_EQ(heap.Top(), 2);
+  EXPECT_EQ(heap.GetKey(2), 5);
+
+  EXPECT_FALSE(heap.PushOrDecrease(1, 25));
+  EXPECT_TRUE(heap.PushOrDecrease(1, 1));
+  EXPECT_TRUE(heap.PushOrDecrease(3, 0));
+  EXPECT_EQ(heap.Pop(), 3);
+  EXPECT_EQ(heap.Pop(), 1);
+}
+
+TEST(IndexedHeapTest, EraseContains) {
+  Aads::IndexedHeap<int> heap(10);
+  for (size_t i = 0; i < 10; ++i) {
+    heap.Push(i, 10 - i);
+  }
+
+  heap.Erase(9);
+  heap.Erase(4);
+  EXPECT_FALSE(heap.Contains(9));
+  EXPECT_FALSE(heap.Contains(4));
+  EXPECT_TRUE(heap.Contains(5));
+  EXPECT_EQ(heap.Size(), 8);
+  EXPECT_EQ(heap.Top(), 8);
+
+  heap.Push(4, 100);
+  heap.Clear();
+  EXPECT_TRUE(heap.Empty());
+  EXPECT_FALSE(heap.Contains(4));
+}
+
+TEST(IndexedHeapTest, CustomCompare) {
+  Aads::IndexedHeap<std::string, std::greater<std::string>, 2> heap(3);
+  heap.Push(0, "apple");
+  heap.Push(1, "pear");
+  heap.Push(2, "fig");
+
+  EXPECT_EQ(heap.TopKey(), "pear");
+  heap.DecreaseKey(0, "zucchini");
+  EXPECT_EQ(heap.Pop(), 0);
+  EXPECT_EQ(heap.Pop(), 1);
+}
+
+template <size_t Arity>
+void CheckAgainstSet() {
+  std::mt19937 rnd(Arity);
+  Aads::IndexedHeap<int, std::less<int>, Arity> heap(200);
+  std::set<std::pair<int, size_t>> expected;
+  std::vector<int> keys(200);
+
+  for (int step = 0; step < 20'000; ++step) {
+    size_t index = rnd() % 200;
+    int key = rnd() % 1000;
+    if (not heap.Contains(index)) {
+      heap.Push(index, key);
+      expected.insert({key, index});
+      keys[index] = key;
+    } else if (rnd() % 3 == 0) {
+      heap.Erase(index);
+      expected.erase({keys[index], index});
+    } else if (key < keys[index]) {
+      heap.DecreaseKey(index, key);
+      expected.erase({keys[index], index});
+      expected.insert({key, index});
+      keys[index] = key;
+    } else if (not expected.empty()) {
+      ASSERT_EQ(heap.TopKey(), expected.begin()->first);
+      size_t top = heap.Pop();
+      expected.erase({keys[top], top});
+    }
+    ASSERT_EQ(heap.Size(), expected.size());
+  }
+}
+
+TEST(IndexedHeapTest, SameAsSet) {
+  CheckAgainstSet<2>();
+  CheckAgainstSet<4>();
+  CheckAgainstSet<7>();
+}
@@ -0,0 +1,273 @@
+#ifndef INCREMENTAL_MATCHING_HPP
+#define INCREMENTAL_MATCHING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "HopcroftKarp/hopcroft_karp.hpp"
+#include "Khun/khun.hpp"
+
+namespace Aads {
+
+// Maximum matching of a bipartite graph under edge and vertex updates. Every
+// update keeps the matching maximum by at most one alternating path search
+// started next to the changed edge, since any new augmenting path has to
+// pass through it. The search only visits the part of the graph reachable
+// by alternating paths from there, usually a small one
+class IncrementalMatching {
+ public:
+  IncrementalMatching() = default;
+
+  IncrementalMatching(size_t left_count, size_t right_count)
+      : left_adj_(left_count),
+        right_adj_(right_count),
+        matching_(left_count, right_count),
+        left_mark_(left_count, 0),
+        right_mark_(right_count, 0),
+        left_next_(left_count),
+        right_next_(right_count) {}
+
+  // Copies the graph and finds the initial matching by Karp-Sipser followed
+  // by Hopcroft-Karp
+  explicit IncrementalMatching(const BipartiteGraph& graph)
+      : IncrementalMatching(graph.CountLeft(), graph.CountRight()) {
+    for (uint32_t left = 0; left < graph.CountLeft(); ++left) {
+      for (uint32_t right : graph.GetAdj(left)) {
+        left_adj_[left].push_back(right);
+        right_adj_[right].push_back(left);
+      }
+    }
+    KarpSipserMatching(graph, matching_);
+    HopcroftKarp().Run(graph, matching_);
+  }
+
+  size_t CountLeft() const { return left_adj_.size(); }
+  size_t CountRight() const { return right_adj_.size(); }
+
+  std::span<const uint32_t> GetAdj(uint32_t left) const {
+    return left_adj_[left];
+  }
+
+  const Matching& GetMatching() const { return matching_; }
+  size_t Size() const { return matching_.Size(); }
+
+  // Returns the index of the new isolated vertex
+  uint32_t AddLeft() {
+    left_adj_.emplace_back();
+    left_mark_.push_back(0);
+    left_next_.push_back(0);
+    matching_.Resize(left_adj_.size(), right_adj_.size());
+    return left_adj_.size() - 1;
+  }
+
+  uint32_t AddRight() {
+    right_adj_.emplace_back();
+    right_mark_.push_back(0);
+    right_next_.push_back(0);
+    matching_.Resize(left_adj_.size(), right_adj_.size());
+    return right_adj_.size() - 1;
+  }
+
+  void AddEdge(uint32_t left, uint32_t right) {
+    left_adj_[left].push_back(right);
+    right_adj_[right].push_back(left);
+
+    if (matching_.IsLeftFree(left) and matching_.IsRightFree(right)) {
+      matching_.Match(left, right);
+    } else if (matching_.IsLeftFree(left)) {
+      StartSearch();
+      FlipForward(FindForward(left));
+    } else if (matching_.IsRightFree(right)) {
+      StartSearch();
+      FlipBackward(FindBackward(right));
+    } else {
+      // The path goes through the partner of left, left, right and the
+      // partner of right. Its halves found by separate searches are
+      // disjoint, otherwise there was an augmenting path before the edge was
+      // added
+      for (bool forward : {true, false}) {
+        StartSearch();
+        left_mark_[left] = epoch_;
+        right_mark_[right] = epoch_;
+        bool found = forward ? FindForward(matching_.MatchOfRight(right))
+                             : FindBackward(matching_.MatchOfLeft(left));
+        if (not found) {
+          return;
+        }
+      }
+      FlipBackward(true);
+      FlipForward(true);
+      matching_.Match(left, right);
+    }
+  }
+
+  // Returns false if there is no such edge. Removes one copy of a multiple
+  // edge
+  bool RemoveEdge(uint32_t left, uint32_t right) {
+    if (not Erase(left_adj_[left], right)) {
+      return false;
+    }
+    Erase(right_adj_[right], left);
+
+    bool is_matched = matching_.MatchOfLeft(left) == right;
+    if (is_matched and not Contains(left_adj_[left], right)) {
+      matching_.Unmatch(left);
+      Repair(left, right);
+    }
+    return true;
+  }
+
+  // Removes all edges of the vertex. The index stays valid
+  void RemoveLeft(uint32_t left) {
+    uint32_t right = matching_.MatchOfLeft(left);
+    for (uint32_t other : left_adj_[left]) {
+      Erase(right_adj_[other], left);
+    }
+    left_adj_[left].clear();
+    matching_.Unmatch(left);
+
+    if (right != Matching::kFree) {
+      StartSearch();
+      FlipBackward(FindBackward(right));
+    }
+  }
+
+  void RemoveRight(uint32_t right) {
+    uint32_t left = matching_.MatchOfRight(right);
+    for (uint32_t other : right_adj_[right]) {
+      Erase(left_adj_[other], right);
+    }
+    right_adj_[right].clear();
+
+    if (left != Matching::kFree) {
+      matching_.Unmatch(left);
+      StartSearch();
+      FlipForward(FindForward(left));
+    }
+  }
+
+ private:
+  // After the matched edge (left, right) is gone, an augmenting path has to
+  // end at one of its now free vertices
+  void Repair(uint32_t left, uint32_t right) {
+    StartSearch();
+    if (FindForward(left)) {
+      FlipForward(true);
+      return;
+    }
+    StartSearch();
+    FlipBackward(FindBackward(right));
+  }
+
+  void StartSearch() { epoch_ += 1; }
+
+  // DFS by alternating paths from a left vertex to a free right vertex
+  // through vertices not marked in this search. On success left_stack_
+  // holds the left vertices of the path, each with its next right vertex at
+  // left_next_
+  bool FindForward(uint32_t start) {
+    return FindPath(start, left_adj_, left_mark_, right_mark_, left_next_,
+                    left_stack_, [&](uint32_t right) {
+                      return matching_.MatchOfRight(right);
+                    });
+  }
+
+  // The same from a right vertex to a free left vertex in right_stack_
+  bool FindBackward(uint32_t start) {
+    return FindPath(start, right_adj_, right_mark_, left_mark_, right_next_,
+                    right_stack_, [&](uint32_t left) {
+                      return matching_.MatchOfLeft(left);
+                    });
+  }
+
+  // Searches from a vertex of one side, adj and mark are of that side and
+  // other_mark of the other one
+  template <typename PartnerOf>
+  bool FindPath(uint32_t start,
+                const std::vector<std::vector<uint32_t>>& adj,
+                std::vector<size_t>& mark,
+                const std::vector<size_t>& other_mark,
+                std::vector<size_t>& next_arc, std::vector<uint32_t>& stack,
+                PartnerOf partner_of) {
+    stack.assign(1, start);
+    mark[start] = epoch_;
+    next_arc[start] = 0;
+
+    while (not stack.empty()) {
+      uint32_t vertex = stack.back();
+      if (next_arc[vertex] == adj[vertex].size()) {
+        stack.pop_back();
+        if (not stack.empty()) {
+          next_arc[stack.back()] += 1;
+        }
+        continue;
+      }
+
+      uint32_t other = adj[vertex][next_arc[vertex]];
+      uint32_t next = partner_of(other);
+      if (other_mark[other] == epoch_ or next == vertex) {
+        next_arc[vertex] += 1;
+      } else if (next == Matching::kFree) {
+        return true;
+      } else if (mark[next] != epoch_) {
+        mark[next] = epoch_;
+        next_arc[next] = 0;
+        stack.push_back(next);
+      } else {
+        next_arc[vertex] += 1;
+      }
+    }
+    return false;
+  }
+
+  void FlipForward(bool found) {
+    if (not found) {
+      return;
+    }
+    for (uint32_t left : left_stack_) {
+      matching_.Match(left, left_adj_[left][left_next_[left]]);
+    }
+  }
+
+  void FlipBackward(bool found) {
+    if (not found) {
+      return;
+    }
+    for (uint32_t right : right_stack_) {
+      matching_.Match(right_adj_[right][right_next_[right]], right);
+    }
+  }
+
+  static bool Erase(std::vector<uint32_t>& adj, uint32_t vertex) {
+    auto it = std::find(adj.begin(), adj.end(), vertex);
+    if (it == adj.end()) {
+      return false;
+    }
+    *it = adj.back();
+    adj.pop_back();
+    return true;
+  }
+
+  static bool Contains(const std::vector<uint32_t>& adj, uint32_t vertex) {
+    return std::find(adj.begin(), adj.end(), vertex) != adj.end();
+  }
+
+  std::vector<std::vector<uint32_t>> left_adj_;
+  std::vector<std::vector<uint32_t>> right_adj_;
+  Matching matching_;
+  // A vertex is visited by the current search if its mark equals epoch_
+  std::vector<size_t> left_mark_;
+  std::vector<size_t> right_mark_;
+  size_t epoch_ = 0;
+  std::vector<size_t> left_next_;
+  std::vector<size_t> right_next_;
+  std::vector<uint32_t> left_stack_;
+  std::vector<uint32_t> right_stack_;
+};
+
+}  // namespace Aads
+
+#endif  // INCREMENTAL_MATCHING_HPP
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Khun/incremental_matching.hpp"
+
+namespace {
+
+size_t MaxMatchingSize(const Aads::IncrementalMatching& incremental) {
+  std::vector<std::pair<uint32_t, uint32_t>> edges;
+  for (uint32_t left = 0; left < incremental.CountLeft(); ++left) {
+    for (uint32_t right : incremental.GetAdj(left)) {
+      edges.emplace_back(left, right);
+    }
+  }
+  Aads::BipartiteGraph graph(incremental.CountLeft(),
+                             incremental.CountRight(), edges);
+  Aads::Matching matching(graph.CountLeft(), graph.CountRight());
+  return Aads::HopcroftKarp().Run(graph, matching);
+}
+
+void ExpectValid(const Aads::IncrementalMatching& incremental) {
+  const Aads::Matching& matching = incremental.GetMatching();
+  size_t size = 0;
+  for (uint32_t left = 0; left < incremental.CountLeft(); ++left) {
+    if (matching.IsLeftFree(left)) {
+      continue;
+    }
+    size += 1;
+    uint32_t right = matching.MatchOfLeft(left);
+    EXPECT_EQ(matching.MatchOfRight(right), left);
+    auto adj = incremental.GetAdj(left);
+    EXPECT_NE(std::find(adj.begin(), adj.end(), right), adj.end());
+  }
+  EXPECT_EQ(size, matching.Size());
+}
+
+}  // namespace
+
+TEST(IncrementalMatchingTest, AddEdges) {
+  Aads::IncrementalMatching matching(2, 2);
+  matching.AddEdge(0, 0);
+  EXPECT_EQ(matching.Size(), 1);
+
+  // Only augments through the new edge: l1 - r0 - l0 - r1
+  matching.AddEdge(1, 0);
+  EXPECT_EQ(matching.Size(), 1);
+  matching.AddEdge(0, 1);
+  EXPECT_EQ(matching.Size(), 2);
+  EXPECT_EQ(matching.GetMatching().MatchOfLeft(0), 1);
+  EXPECT_EQ(matching.GetMatching().MatchOfLeft(1), 0);
+}
+
+TEST(IncrementalMatchingTest, BothEndsMatched) {
+  // l0 - r0 and l1 - r1 are matched, l2 and r2 are free. The new edge
+  // l0 - r1 completes l2 - r0 - l0 - r1 - l1 - r2
+  Aads::IncrementalMatching matching(Aads::BipartiteGraph(
+      3, 3, {{0, 0}, {1, 1}, {2, 0}, {1, 2}}));
+  ASSERT_EQ(matching.Size(), 2);
+
+  matching.AddEdge(0, 1);
+  EXPECT_EQ(matching.Size(), 3);
+  ExpectValid(matching);
+}
+
+TEST(IncrementalMatchingTest, RemoveEdgesAndVertices) {
+  Aads::IncrementalMatching matching(
+      Aads::BipartiteGraph(2, 2, {{0, 0}, {0, 1}, {1, 0}}));
+  EXPECT_EQ(matching.Size(), 2);
+
+  EXPECT_FALSE(matching.RemoveEdge(1, 1));
+  EXPECT_TRUE(matching.RemoveEdge(1, 0));
+  EXPECT_EQ(matching.Size(), 1);
+
+  uint32_t left = matching.AddLeft();
+  uint32_t right = matching.AddRight();
+  matching.AddEdge(left, 1);
+  matching.AddEdge(left, right);
+  EXPECT_EQ(matching.Size(), 2);
+
+  matching.RemoveRight(right);
+  EXPECT_EQ(matching.Size(), 2);
+  ExpectValid(matching);
+  matching.RemoveLeft(0);
+  EXPECT_EQ(matching.Size(), 1);
+  ExpectValid(matching);
+}
+
+TEST(IncrementalMatchingTest, RandomUpdatesStayMaximum) {
+  std::mt19937 rnd(17);
+  std::vector<std::pair<uint32_t, uint32_t>> edges;
+  for (size_t idx = 0; idx < 60; ++idx) {
+    edges.emplace_back(rnd() % 40, rnd() % 40);
+  }
+  Aads::IncrementalMatching matching(Aads::BipartiteGraph(40, 40, edges));
+  EXPECT_EQ(matching.Size(), MaxMatchingSize(matching));
+
+  for (size_t iter = 0; iter < 500; ++iter) {
+    uint32_t left = rnd() % matching.CountLeft();
+    uint32_t right = rnd() % matching.CountRight();
+    switch (rnd() % 8) {
+      case 0:
+        matching.RemoveLeft(left);
+        break;
+      case 1:
+        matching.RemoveRight(right);
+        break;
+      case 2:
+        if (matching.GetAdj(left).empty()) {
+          break;
+        }
+        right = matching.GetAdj(left)[rnd() % matching.GetAdj(left).size()];
+        [[fallthrough]];
+      case 3:
+        matching.RemoveEdge(left, right);
+        break;
+      default:
+        matching.AddEdge(left, right);
+    }
+    ASSERT_EQ(matching.Size(), MaxMatchingSize(matching)) << iter;
+    ExpectValid(matching);
+  }
+}
@@ -1,9 +1,14 @@
 #ifndef KHUN_HPP
 #define KHUN_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <span>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace Aads {
@@ -171,12 +176,329 @@ struct VertexHash {
   }
 
  private:
-  const size_t kBigNumber = 1474747489162319795;
+  static constexpr size_t kBigNumber = 1474747489162319795;
 };
 
 using GraphT =
     BipartGraphImpl<Vertex, std::pair<Vertex, Vertex>, false, VertexHash>;
 
+// Bipartite graph with left vertices 0..CountLeft()-1 and right vertices
+// 0..CountRight()-1. Arcs of every left vertex are stored contiguously as
+// right vertex indices, so matching algorithms scan flat arrays
+class BipartiteGraph {
+ public:
+  BipartiteGraph() = default;
+
+  // Edges are (left, right) pairs
+  BipartiteGraph(size_t left_count, size_t right_count,
+                 const std::vector<std::pair<uint32_t, uint32_t>>& edges)
+      : right_count_(right_count), offsets_(left_count + 1) {
+    for (auto [left, right] : edges) {
+      offsets_[left + 1] += 1;
+    }
+    for (size_t left = 0; left < left_count; ++left) {
+      offsets_[left + 1] += offsets_[left];
+    }
+
+    heads_.resize(edges.size());
+    std::vector<size_t> fill(offsets_.begin(), offsets_.end() - 1);
+    for (auto [left, right] : edges) {
+      heads_[fill[left]++] = right;
+    }
+  }
+
+  // Converts a graph of BipartGraphImpl kind. Left vertices are numbered by
+  // their position in LeftPart and right vertices in the order of their
+  // first occurrence, right_vertices receives the original right vertices
+  template <typename BipartitionGraph, typename Vertex, typename VertexHash>
+  static BipartiteGraph FromGraph(const BipartitionGraph& graph,
+                                  std::vector<Vertex>& right_vertices) {
+    BipartiteGraph res;
+    std::unordered_map<Vertex, uint32_t, VertexHash> right_index;
+    res.offsets_.reserve(graph.LeftPart().size() + 1);
+
+    for (const auto& left : graph.LeftPart()) {
+      for (const auto& edge : graph.GetAdj(left)) {
+        auto [it, inserted] =
+            right_index.try_emplace(edge.second, right_vertices.size());
+        if (inserted) {
+          right_vertices.push_back(edge.second);
+        }
+        res.heads_.push_back(it->second);
+      }
+      res.offsets_.push_back(res.heads_.size());
+    }
+    res.right_count_ = right_vertices.size();
+    return res;
+  }
+
+  size_t CountLeft() const { return offsets_.size() - 1; }
+  size_t CountRight() const { return right_count_; }
+  size_t CountEdges() const { return heads_.size(); }
+
+  std::span<const uint32_t> GetAdj(uint32_t left) const {
+    return std::span(heads_).subspan(offsets_[left],
+                                     offsets_[left + 1] - offsets_[left]);
+  }
+
+  // Arcs are numbered 0..CountEdges()-1 in the order of the constructor
+  // edges grouped by left vertex, GetAdj(left)[idx] is arc
+  // FirstArc(left) + idx. Used to attach data such as costs to arcs
+  size_t FirstArc(uint32_t left) const { return offsets_[left]; }
+
+ private:
+  size_t right_count_ = 0;
+  std::vector<size_t> offsets_ = {0};
+  std::vector<uint32_t> heads_;
+};
+
+// Matching of a graph with dense left and right vertices, the partner of
+// every vertex is stored in a flat array
+class Matching {
+ public:
+  static constexpr uint32_t kFree = std::numeric_limits<uint32_t>::max();
+
+  Matching() = default;
+
+  Matching(size_t left_count, size_t right_count)
+      : match_left_(left_count, kFree), match_right_(right_count, kFree) {}
+
+  size_t Size() const { return size_; }
+  size_t CountLeft() const { return match_left_.size(); }
+  size_t CountRight() const { return match_right_.size(); }
+
+  // kFree for unmatched vertices
+  uint32_t MatchOfLeft(uint32_t left) const { return match_left_[left]; }
+  uint32_t MatchOfRight(uint32_t right) const { return match_right_[right]; }
+
+  bool IsLeftFree(uint32_t left) const { return match_left_[left] == kFree; }
+  bool IsRightFree(uint32_t right) const {
+    return match_right_[right] == kFree;
+  }
+
+  // Previous partners of left and right become free
+  void Match(uint32_t left, uint32_t right) {
+    Unmatch(left);
+    if (match_right_[right] != kFree) {
+      Unmatch(match_right_[right]);
+    }
+    match_left_[left] = right;
+    match_right_[right] = left;
+    size_ += 1;
+  }
+
+  void Unmatch(uint32_t left) {
+    if (match_left_[left] == kFree) {
+      return;
+    }
+    match_right_[match_left_[left]] = kFree;
+    match_left_[left] = kFree;
+    size_ -= 1;
+  }
+
+  // New vertices are free, vertices past the new counts are unmatched first
+  void Resize(size_t left_count, size_t right_count) {
+    for (size_t left = left_count; left < match_left_.size(); ++left) {
+      Unmatch(left);
+    }
+    for (size_t right = right_count; right < match_right_.size(); ++right) {
+      if (match_right_[right] != kFree) {
+        Unmatch(match_right_[right]);
+      }
+    }
+    match_left_.resize(left_count, kFree);
+    match_right_.resize(right_count, kFree);
+  }
+
+ private:
+  size_t size_ = 0;
+  std::vector<uint32_t> match_left_;
+  std::vector<uint32_t> match_right_;
+};
+
+// Kuhn's algorithm on a graph with dense vertices, such as BipartiteGraph:
+// graph.CountLeft(), graph.CountRight() and graph.GetAdj(left), a random
+// access range of right vertices. Augments the given matching, which may be
+// non-empty, and returns its size. The DFS keeps an explicit stack, and left
+// vertices that failed to reach a free vertex are not visited again until
+// the matching changes
+template <typename Graph>
+size_t KuhnMaxMatching(const Graph& graph, Matching& matching) {
+  std::vector<size_t> visited(graph.CountLeft(), 0);
+  std::vector<size_t> next_arc(graph.CountLeft());
+  std::vector<uint32_t> stack;
+  size_t epoch = 1;
+
+  for (uint32_t root = 0; root < graph.CountLeft(); ++root) {
+    if (not matching.IsLeftFree(root)) {
+      continue;
+    }
+    stack.assign(1, root);
+    visited[root] = epoch;
+    next_arc[root] = 0;
+
+    while (not stack.empty()) {
+      uint32_t left = stack.back();
+      auto adj = graph.GetAdj(left);
+      if (next_arc[left] == adj.size()) {
+        stack.pop_back();
+        if (not stack.empty()) {
+          next_arc[stack.back()] += 1;
+        }
+        continue;
+      }
+
+      uint32_t right = adj[next_arc[left]];
+      uint32_t next = matching.MatchOfRight(right);
+      if (next == Matching::kFree) {
+        // Every left vertex of the stack takes the right vertex of its
+        // current arc
+        for (uint32_t path_left : stack) {
+          matching.Match(path_left,
+                         graph.GetAdj(path_left)[next_arc[path_left]]);
+        }
+        epoch += 1;
+        break;
+      }
+      if (visited[next] != epoch) {
+        visited[next] = epoch;
+        next_arc[next] = 0;
+        stack.push_back(next);
+      } else {
+        next_arc[left] += 1;
+      }
+    }
+  }
+
+  return matching.Size();
+}
+
+// Matches every free left vertex with its first free right neighbour, in
+// O(V + E) time. Returns the size of the matching
+template <typename Graph>
+size_t GreedyMatching(const Graph& graph, Matching& matching) {
+  for (uint32_t left = 0; left < graph.CountLeft(); ++left) {
+    if (not matching.IsLeftFree(left)) {
+      continue;
+    }
+    for (uint32_t right : graph.GetAdj(left)) {
+      if (matching.IsRightFree(right)) {
+        matching.Match(left, right);
+        break;
+      }
+    }
+  }
+  return matching.Size();
+}
+
+// Karp-Sipser heuristic in O(V + E) time. A free vertex with a single free
+// neighbour is matched with it, which never makes the matching smaller than
+// the maximum one. Only when no such vertex is left an arbitrary edge is
+// taken. Usually settles all but a few vertices, so a maximum matching
+// algorithm started from the result has little left to do. Already matched
+// vertices of the given matching are kept. Returns the size of the matching
+template <typename Graph>
+size_t KarpSipserMatching(const Graph& graph, Matching& matching) {
+  size_t left_count = graph.CountLeft();
+  size_t right_count = graph.CountRight();
+
+  // Arcs of right vertices to left ones
+  std::vector<size_t> offsets(right_count + 1, 0);
+  for (uint32_t left = 0; left < left_count; ++left) {
+    for (uint32_t right : graph.GetAdj(left)) {
+      offsets[right + 1] += 1;
+    }
+  }
+  for (size_t right = 0; right < right_count; ++right) {
+    offsets[right + 1] += offsets[right];
+  }
+  std::vector<uint32_t> lefts(offsets.back());
+  std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+  for (uint32_t left = 0; left < left_count; ++left) {
+    for (uint32_t right : graph.GetAdj(left)) {
+      lefts[fill[right]++] = left;
+    }
+  }
+
+  // Left vertices are 0..left_count-1 and right vertex r is left_count + r.
+  // degree is the number of arcs to free vertices
+  auto is_free = [&](size_t vertex) {
+    return vertex < left_count ? matching.IsLeftFree(vertex)
+                               : matching.IsRightFree(vertex - left_count);
+  };
+  auto for_each_neighbour = [&](size_t vertex, auto&& visit) {
+    if (vertex < left_count) {
+      for (uint32_t right : graph.GetAdj(vertex)) {
+        visit(left_count + right);
+      }
+    } else {
+      size_t right = vertex - left_count;
+      for (size_t idx = offsets[right]; idx < offsets[right + 1]; ++idx) {
+        visit(lefts[idx]);
+      }
+    }
+  };
+
+  std::vector<uint32_t> degree(left_count + right_count, 0);
+  std::vector<size_t> single;
+  for (size_t vertex = 0; vertex < degree.size(); ++vertex) {
+    if (not is_free(vertex)) {
+      continue;
+    }
+    for_each_neighbour(vertex, [&](size_t next) {
+      degree[vertex] += is_free(next) ? 1 : 0;
+    });
+    if (degree[vertex] == 1) {
+      single.push_back(vertex);
+    }
+  }
+
+  auto match = [&](size_t vertex, size_t next) {
+    size_t left = std::min(vertex, next);
+    size_t right = std::max(vertex, next) - left_count;
+    matching.Match(left, right);
+    for (size_t end : {vertex, next}) {
+      for_each_neighbour(end, [&](size_t other) {
+        if (is_free(other) and --degree[other] == 1) {
+          single.push_back(other);
+        }
+      });
+    }
+  };
+  auto first_free_neighbour = [&](size_t vertex) {
+    size_t found = vertex;
+    for_each_neighbour(vertex, [&](size_t next) {
+      if (found == vertex and is_free(next)) {
+        found = next;
+      }
+    });
+    return found;
+  };
+
+  size_t next_left = 0;
+  while (true) {
+    if (not single.empty()) {
+      size_t vertex = single.back();
+      single.pop_back();
+      if (is_free(vertex) and degree[vertex] > 0) {
+        match(vertex, first_free_neighbour(vertex));
+      }
+      continue;
+    }
+
+    while (next_left < left_count and
+           not (is_free(next_left) and degree[next_left] > 0)) {
+      next_left += 1;
+    }
+    if (next_left == left_count) {
+      break;
+    }
+    match(next_left, first_free_neighbour(next_left));
+  }
+
+  return matching.Size();
+}
+
 }  // namespace Aads
 
 #endif  // KHUN_HPP
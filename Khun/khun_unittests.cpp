@@ -1,4 +1,8 @@
 #include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
 #include "Khun/khun.hpp"
 
 TEST(KhunTest, SimpleMatching) {
@@ -60,3 +64,104 @@ TEST(KhunTest, CompleteMatching) {
   
   EXPECT_EQ(matching.size(), 3);  // Perfect matching
 }
+
+TEST(KhunTest, BipartiteGraph) {
+  Aads::BipartiteGraph graph(3, 2, {{2, 1}, {0, 0}, {2, 0}});
+
+  EXPECT_EQ(graph.CountLeft(), 3);
+  EXPECT_EQ(graph.CountRight(), 2);
+  EXPECT_EQ(graph.CountEdges(), 3);
+  EXPECT_EQ(graph.GetAdj(0).size(), 1);
+  EXPECT_TRUE(graph.GetAdj(1).empty());
+  EXPECT_EQ(graph.GetAdj(2)[0], 1);
+  EXPECT_EQ(graph.GetAdj(2)[1], 0);
+
+  Aads::GraphT hashed;
+  hashed.AddVertexToLeft({7, false});
+  hashed.AddEdge({{7, false}, {3, true}});
+  std::vector<Aads::Vertex> right_vertices;
+  Aads::BipartiteGraph converted =
+      Aads::BipartiteGraph::FromGraph<Aads::GraphT, Aads::Vertex,
+                                      Aads::VertexHash>(hashed,
+                                                        right_vertices);
+  EXPECT_EQ(converted.CountLeft(), 1);
+  EXPECT_EQ(converted.CountRight(), 1);
+  EXPECT_EQ(right_vertices[converted.GetAdj(0)[0]].index, 3);
+}
+
+TEST(KhunTest, FlatMatching) {
+  Aads::Matching matching(2, 2);
+  matching.Match(0, 0);
+  matching.Match(1, 1);
+  EXPECT_EQ(matching.Size(), 2);
+
+  // Partners of both ends are unmatched
+  matching.Match(0, 1);
+  EXPECT_EQ(matching.Size(), 1);
+  EXPECT_TRUE(matching.IsLeftFree(1));
+  EXPECT_TRUE(matching.IsRightFree(0));
+  EXPECT_EQ(matching.MatchOfRight(1), 0);
+
+  matching.Resize(2, 1);
+  EXPECT_EQ(matching.Size(), 0);
+  EXPECT_EQ(matching.MatchOfLeft(0), Aads::Matching::kFree);
+}
+
+TEST(KhunTest, DenseKuhn) {
+  // Greedy 0-0 blocks 1, the maximum matching is 0-1, 1-0
+  Aads::BipartiteGraph graph(3, 2, {{0, 0}, {0, 1}, {1, 0}, {2, 1}});
+  Aads::Matching matching(3, 2);
+
+  EXPECT_EQ(Aads::KuhnMaxMatching(graph, matching), 2);
+  EXPECT_FALSE(matching.IsLeftFree(1));
+
+  // Starts from the given matching
+  Aads::Matching partial(3, 2);
+  partial.Match(2, 1);
+  EXPECT_EQ(Aads::KuhnMaxMatching(graph, partial), 2);
+}
+
+TEST(KhunTest, GreedyAndKarpSipser) {
+  // A path l0 - r0 - l1 - r1 - l2: greedy takes l0-r0 and l1-r1, Karp-Sipser
+  // starts from the degree one vertices and is optimal on forests
+  Aads::BipartiteGraph path(3, 2, {{0, 0}, {1, 0}, {1, 1}, {2, 1}});
+  Aads::Matching greedy(3, 2);
+  Aads::Matching karp_sipser(3, 2);
+
+  EXPECT_EQ(Aads::GreedyMatching(path, greedy), 2);
+  EXPECT_EQ(Aads::KarpSipserMatching(path, karp_sipser), 2);
+
+  // Greedy matches l0-r0 and blocks l1, Karp-Sipser takes l1-r0 first
+  Aads::BipartiteGraph star(2, 2, {{0, 0}, {0, 1}, {1, 0}});
+  greedy = Aads::Matching(2, 2);
+  karp_sipser = Aads::Matching(2, 2);
+  EXPECT_EQ(Aads::GreedyMatching(star, greedy), 1);
+  EXPECT_EQ(Aads::KarpSipserMatching(star, karp_sipser), 2);
+}
+
+TEST(KhunTest, KarpSipserWarmStart) {
+  std::mt19937 rnd(5);
+  for (size_t iter = 0; iter < 10; ++iter) {
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    for (size_t idx = 0; idx < 150; ++idx) {
+      edges.emplace_back(rnd() % 100, rnd() % 100);
+    }
+    Aads::BipartiteGraph graph(100, 100, edges);
+
+    Aads::Matching matching(100, 100);
+    size_t warm = Aads::KarpSipserMatching(graph, matching);
+    for (uint32_t left = 0; left < 100; ++left) {
+      if (not matching.IsLeftFree(left)) {
+        auto adj = graph.GetAdj(left);
+        EXPECT_NE(std::find(adj.begin(), adj.end(),
+                            matching.MatchOfLeft(left)),
+                  adj.end());
+      }
+    }
+
+    Aads::Matching expected(100, 100);
+    Aads::KuhnMaxMatching(graph, expected);
+    EXPECT_LE(warm, expected.Size());
+    EXPECT_EQ(Aads::KuhnMaxMatching(graph, matching), expected.Size());
+  }
+}
@@ -16,6 +16,7 @@ class Graph {
  public:
   using VertexT = T;
   using EdgeT = std::pair<VertexT, VertexT>;
+  static constexpr bool kIsDirected = IsDirected;
 
   size_t CountVertexs() const { return adj_.size(); }
   size_t CountEdges() const { return edgecount_; }
@@ -104,7 +105,7 @@ class Visitor {
   std::unordered_set<Vertex> visited_;
 };
 
-std::unordered_map<int, int> BuildTOut(const DirGraph<int>& graph) {
+inline std::unordered_map<int, int> BuildTOut(const DirGraph<int>& graph) {
   std::vector<int> t_out(graph.CountVertexs());
   TOutVisitor<int> t_out_visitor;
 
@@ -118,7 +119,7 @@ std::unordered_map<int, int> BuildTOut(const DirGraph<int>& graph) {
   return t_out_visitor.GetTOut();
 }
 
-std::vector<int> SortByTOut(const DirGraph<int>& graph) {
+inline std::vector<int> SortByTOut(const DirGraph<int>& graph) {
   std::unordered_map<int, int> t_out = BuildTOut(graph);
   std::vector<int> sorted(graph.CountVertexs());
 
@@ -131,33 +132,98 @@ std::vector<int> SortByTOut(const DirGraph<int>& graph) {
   return sorted;
 }
 
-std::vector<int> Condensate(const DirGraph<int>& graph) {
-  std::vector<int> sorted_by_t_out = SortByTOut(graph);
-  DirGraph<int> transponed = Transponed(graph);
-
-  std::vector<int> condensated(graph.CountVertexs());
-  std::vector<bool> visited(graph.CountVertexs());
-  int comp_count = 1;
-
-  for (size_t vertex : sorted_by_t_out) {
-    if (visited[vertex]) {
+// Strongly connected components in one DFS pass, Pearce's variant of
+// Tarjan's algorithm. Vertices must be 0..graph.CountVertexs()-1. rindex
+// holds the DFS index of a vertex while it is open and its component once
+// it is done, so there is a single flat array and no transposed graph. The
+// DFS keeps an explicit stack of (vertex, next arc) frames.
+// Components are completed in reverse topological order. They are numbered
+// 1..k from the last completed one, which is the labelling of the two pass
+// Kosaraju algorithm when both visit vertices and arcs in the same order
+template <typename Graph>
+std::vector<int> StrongComponents(const Graph& graph) {
+  using Vertex = typename Graph::VertexT;
+  size_t size = graph.CountVertexs();
+  // Open vertices get indices 1..size, components get 2 * size,
+  // 2 * size - 1, ... so that a finished vertex never lowers an index
+  std::vector<size_t> rindex(size, 0);
+  std::vector<bool> is_root(size, false);
+  size_t index = 1;
+  size_t component = 2 * size;
+
+  struct Frame {
+    Vertex vertex;
+    std::span<const Vertex> adj;
+    size_t next_arc;
+  };
+  std::vector<Frame> frames;
+  std::vector<Vertex> open;
+
+  auto enter = [&](Vertex vertex) {
+    rindex[vertex] = index++;
+    is_root[vertex] = true;
+    frames.push_back({vertex, graph.GetAdj(vertex), 0});
+  };
+
+  for (size_t start = 0; start < size; ++start) {
+    if (rindex[start] != 0) {
       continue;
     }
+    enter(start);
+
+    while (not frames.empty()) {
+      Frame& frame = frames.back();
+      Vertex vertex = frame.vertex;
+      if (frame.next_arc < frame.adj.size()) {
+        Vertex next = frame.adj[frame.next_arc];
+        if (rindex[next] == 0) {
+          enter(next);
+          continue;
+        }
+        frame.next_arc += 1;
+        if (rindex[next] < rindex[vertex]) {
+          rindex[vertex] = rindex[next];
+          is_root[vertex] = false;
+        }
+        continue;
+      }
 
-    Visitor<int> visitor;
-    DFS(transponed, vertex, visitor);
+      frames.pop_back();
+      if (is_root[vertex]) {
+        index -= 1;
+        while (not open.empty() and rindex[vertex] <= rindex[open.back()]) {
+          rindex[open.back()] = component;
+          open.pop_back();
+          index -= 1;
+        }
+        rindex[vertex] = component;
+        component -= 1;
+      } else {
+        open.push_back(vertex);
+      }
 
-    for (int comp_vertex : visitor.GetVisited()) {
-      visited[comp_vertex] = true;
-      if (condensated[comp_vertex] == 0) {
-        condensated[comp_vertex] = comp_count;
+      // The parent takes the lowest index reached by the child
+      if (not frames.empty()) {
+        Frame& parent = frames.back();
+        parent.next_arc += 1;
+        if (rindex[vertex] < rindex[parent.vertex]) {
+          rindex[parent.vertex] = rindex[vertex];
+          is_root[parent.vertex] = false;
+        }
       }
     }
+  }
 
-    comp_count += 1;
+  // The last completed component got component + 1
+  std::vector<int> res(size);
+  for (size_t vertex = 0; vertex < size; ++vertex) {
+    res[vertex] = rindex[vertex] - component;
   }
+  return res;
+}
 
-  return condensated;
+inline std::vector<int> Condensate(const DirGraph<int>& graph) {
+  return StrongComponents(graph);
 }
 
 }  // namespace Aads
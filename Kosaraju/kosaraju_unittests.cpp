@@ -1,4 +1,9 @@
 #include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
 #include "Kosaraju/kosaraju.hpp"
 
 TEST(KosarajuTest, SingleSCC) {
@@ -56,3 +61,76 @@ TEST(KosarajuTest, ComplexGraph) {
   EXPECT_EQ(condensated[2], condensated[3]);
   EXPECT_NE(condensated[0], condensated[2]);
 }
+
+namespace {
+
+// The two pass algorithm Condensate used before, as the reference labelling
+std::vector<int> TwoPassCondensate(const Aads::DirGraph<int>& graph) {
+  std::vector<int> sorted_by_t_out = Aads::SortByTOut(graph);
+  Aads::DirGraph<int> transponed = Aads::Transponed(graph);
+  std::vector<int> condensated(graph.CountVertexs());
+  int comp_count = 1;
+
+  for (int vertex : sorted_by_t_out) {
+    if (condensated[vertex] != 0) {
+      continue;
+    }
+    Aads::Visitor<int> visitor;
+    for (size_t other = 0; other < graph.CountVertexs(); ++other) {
+      if (condensated[other] != 0) {
+        visitor.Explore(other);
+      }
+    }
+    Aads::DFS(transponed, vertex, visitor);
+    for (int comp_vertex : visitor.GetVisited()) {
+      if (condensated[comp_vertex] == 0) {
+        condensated[comp_vertex] = comp_count;
+      }
+    }
+    comp_count += 1;
+  }
+  return condensated;
+}
+
+}  // namespace
+
+TEST(KosarajuTest, SameLabellingAsTwoPass) {
+  std::mt19937 rnd(8);
+  for (size_t iter = 0; iter < 30; ++iter) {
+    Aads::DirGraph<int> graph;
+    size_t size = 5 + iter;
+    for (size_t vertex = 0; vertex < size; ++vertex) {
+      graph.AddEdge(vertex, vertex);
+    }
+    for (size_t edge = 0; edge < size + iter % 7 * size / 4; ++edge) {
+      graph.AddEdge(rnd() % size, rnd() % size);
+    }
+
+    EXPECT_EQ(Aads::Condensate(graph), TwoPassCondensate(graph));
+  }
+}
+
+TEST(KosarajuTest, TopologicalLabels) {
+  Aads::DirGraph<int> graph;
+  graph.AddEdge(2, 1);
+  graph.AddEdge(1, 0);
+  graph.AddEdge(0, 1);
+  graph.AddEdge(3, 3);
+
+  // Components are numbered so that edges go from lower to higher labels
+  EXPECT_EQ(Aads::Condensate(graph), std::vector<int>({3, 3, 2, 1}));
+}
+
+TEST(KosarajuTest, LongPathWithoutRecursion) {
+  // Deep enough to overflow the call stack of a recursive DFS
+  const int size = 1'000'000;
+  Aads::DirGraph<int> graph;
+  for (int vertex = 0; vertex + 1 < size; ++vertex) {
+    graph.AddEdge(vertex, vertex + 1);
+  }
+  graph.AddEdge(size - 1, 0);
+
+  std::vector<int> components = Aads::StrongComponents(graph);
+  EXPECT_TRUE(std::all_of(components.begin(), components.end(),
+                          [](int label) { return label == 1; }));
+}
@@ -0,0 +1,242 @@
+#ifndef MANY_TO_MANY_HPP
+#define MANY_TO_MANY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "ContractionHierarchies/contraction_hierarchies.hpp"
+#include "Dijkstra/dijkstra_engine.hpp"
+
+namespace Aads {
+
+// Row-major |sources| x |targets| table of distances
+class DistanceTable {
+ public:
+  DistanceTable(size_t sources_count, size_t targets_count)
+      : targets_count_(targets_count),
+        values_(sources_count * targets_count, kUnreachable) {}
+
+  size_t CountSources() const {
+    return targets_count_ == 0 ? 0 : values_.size() / targets_count_;
+  }
+  size_t CountTargets() const { return targets_count_; }
+
+  Distance Get(size_t source_idx, size_t target_idx) const {
+    return values_[source_idx * targets_count_ + target_idx];
+  }
+
+  void Set(size_t source_idx, size_t target_idx, Distance dist) {
+    values_[source_idx * targets_count_ + target_idx] = dist;
+  }
+
+  std::span<const Distance> Row(size_t source_idx) const {
+    return std::span(values_).subspan(source_idx * targets_count_,
+                                      targets_count_);
+  }
+
+ private:
+  size_t targets_count_;
+  std::vector<Distance> values_;
+};
+
+// One Dijkstra run per source. Every thread owns an engine whose workspace is
+// reset in O(touched) between its sources. threads = 0 means
+// std::thread::hardware_concurrency()
+inline DistanceTable BatchedDistances(const StaticGraph& graph,
+                                      std::span<const uint32_t> sources,
+                                      std::span<const uint32_t> targets,
+                                      size_t threads = 0) {
+  DistanceTable table(sources.size(), targets.size());
+  if (threads == 0) {
+    threads = std::max(std::thread::hardware_concurrency(), 1U);
+  }
+  threads = std::min(threads, sources.size());
+  std::atomic<size_t> next_source = 0;
+
+  auto worker = [&]() {
+    DijkstraEngine<> engine(graph);
+    for (size_t idx = next_source++; idx < sources.size();
+         idx = next_source++) {
+      engine.Run(sources[idx]);
+      for (size_t target_idx = 0; target_idx < targets.size(); ++target_idx) {
+        table.Set(idx, target_idx, engine.GetDistance(targets[target_idx]));
+      }
+    }
+  };
+
+  if (threads <= 1) {
+    worker();
+  } else {
+    std::vector<std::thread> workers;
+    for (size_t thread = 0; thread < threads; ++thread) {
+      workers.emplace_back(worker);
+    }
+    for (std::thread& thread : workers) {
+      thread.join();
+    }
+  }
+
+  return table;
+}
+
+namespace {
+
+// Full Dijkstra over upward (or reversed downward) arcs of a hierarchy
+class UpwardSearch {
+ public:
+  explicit UpwardSearch(const ContractionHierarchy& hierarchy)
+      : hierarchy_(hierarchy), workspace_(hierarchy.CountVertices()) {}
+
+  void Run(uint32_t start, bool is_forward) {
+    workspace_.Reset();
+    queue_.Reset(StaticGraph());
+    workspace_.Relax(start, 0);
+    queue_.Push(start, 0);
+
+    while (not queue_.Empty()) {
+      auto [dist, vertex] = queue_.Pop();
+      if (dist != workspace_.GetDistance(vertex)) {
+        continue;
+      }
+      auto arcs = is_forward ? hierarchy_.GetUp(vertex)
+                             : hierarchy_.GetDown(vertex);
+      for (StaticGraph::Arc arc : arcs) {
+        if (workspace_.Relax(arc.to, dist + arc.weight)) {
+          queue_.Push(arc.to, dist + arc.weight);
+        }
+      }
+    }
+  }
+
+  const SearchWorkspace& Workspace() const { return workspace_; }
+
+ private:
+  const ContractionHierarchy& hierarchy_;
+  SearchWorkspace workspace_;
+  RadixHeap queue_;
+};
+
+}  // namespace
+
+// Bucket-based many-to-many on a contraction hierarchy. The upward search of
+// every target leaves (target, distance) in a bucket of each vertex it
+// reaches, then the upward search of every source scans the buckets of the
+// vertices it reaches. Costs |S| + |T| small upward searches instead of |S|
+// full Dijkstra runs
+inline DistanceTable ManyToManyDistances(
+    const ContractionHierarchy& hierarchy, std::span<const uint32_t> sources,
+    std::span<const uint32_t> targets) {
+  struct BucketEntry {
+    uint32_t vertex;
+    uint32_t target_idx;
+    Distance dist;
+  };
+
+  DistanceTable table(sources.size(), targets.size());
+  UpwardSearch search(hierarchy);
+  std::vector<BucketEntry> entries;
+
+  for (size_t target_idx = 0; target_idx < targets.size(); ++target_idx) {
+    search.Run(targets[target_idx], false);
+    for (uint32_t vertex : search.Workspace().Touched()) {
+      entries.push_back({vertex, static_cast<uint32_t>(target_idx),
+                         search.Workspace().GetDistance(vertex)});
+    }
+  }
+
+  // Buckets of vertex are entries[offsets[vertex]..offsets[vertex + 1])
+  std::sort(entries.begin(), entries.end(),
+            [](const BucketEntry& lhs, const BucketEntry& rhs) {
+              return lhs.vertex < rhs.vertex;
+            });
+  std::vector<uint32_t> offsets(hierarchy.CountVertices() + 1);
+  for (const BucketEntry& entry : entries) {
+    offsets[entry.vertex + 1] += 1;
+  }
+  for (size_t i = 1; i < offsets.size(); ++i) {
+    offsets[i] += offsets[i - 1];
+  }
+
+  for (size_t source_idx = 0; source_idx < sources.size(); ++source_idx) {
+    search.Run(sources[source_idx], true);
+    for (uint32_t vertex : search.Workspace().Touched()) {
+      Distance dist = search.Workspace().GetDistance(vertex);
+      for (size_t i = offsets[vertex]; i < offsets[vertex + 1]; ++i) {
+        const BucketEntry& entry = entries[i];
+        if (dist + entry.dist < table.Get(source_idx, entry.target_idx)) {
+          table.Set(source_idx, entry.target_idx, dist + entry.dist);
+        }
+      }
+    }
+  }
+
+  return table;
+}
+
+// Multi-source Dijkstra: a virtual super-source is joined to every facility
+// by a zero arc, so one run finds the closest facility of every vertex. On
+// directed graphs distances go from facilities to vertices, run on the
+// reversed graph for distances to facilities
+class NearestFacility {
+ public:
+  static constexpr uint32_t kNoFacility =
+      std::numeric_limits<uint32_t>::max();
+
+  explicit NearestFacility(const StaticGraph& graph)
+      : graph_(graph),
+        workspace_(graph.CountVertices()),
+        facility_(graph.CountVertices(), kNoFacility) {}
+
+  void Run(std::span<const uint32_t> facilities) {
+    workspace_.Reset();
+    queue_.Reset(graph_);
+    for (uint32_t facility : facilities) {
+      if (workspace_.Relax(facility, 0)) {
+        facility_[facility] = facility;
+        queue_.Push(facility, 0);
+      }
+    }
+
+    while (not queue_.Empty()) {
+      auto [dist, vertex] = queue_.Pop();
+      if (dist != workspace_.GetDistance(vertex)) {
+        continue;
+      }
+      for (StaticGraph::Arc arc : graph_.GetAdj(vertex)) {
+        if (workspace_.Relax(arc.to, dist + arc.weight)) {
+          facility_[arc.to] = facility_[vertex];
+          queue_.Push(arc.to, dist + arc.weight);
+        }
+      }
+    }
+  }
+
+  Distance GetDistance(uint32_t vertex) const {
+    return workspace_.GetDistance(vertex);
+  }
+
+  // kNoFacility if no facility reaches vertex
+  uint32_t GetFacility(uint32_t vertex) const {
+    return workspace_.IsReached(vertex) ? facility_[vertex] : kNoFacility;
+  }
+
+  // Vertices reached by the last run
+  std::span<const uint32_t> Reached() const { return workspace_.Touched(); }
+
+ private:
+  const StaticGraph& graph_;
+  SearchWorkspace workspace_;
+  RadixHeap queue_;
+  // Valid for reached vertices only
+  std::vector<uint32_t> facility_;
+};
+
+}  // namespace Aads
+
+#endif  // MANY_TO_MANY_HPP
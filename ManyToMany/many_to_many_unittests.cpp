@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "GraphGenerators/graph_generators.hpp"
+#include "ManyToMany/many_to_many.hpp"
+
+namespace {
+
+Aads::StaticGraph BuildStaticGraph(const Aads::GeneratedGraph& generated,
+                                   bool is_directed = false) {
+  std::vector<Aads::Edge<int>> edges;
+  for (const auto& edge : generated.edges) {
+    edges.emplace_back(edge.from, edge.to, edge.weight);
+  }
+  return Aads::StaticGraph(generated.vertex_count, edges, is_directed);
+}
+
+std::vector<uint32_t> RandomVertices(size_t count, size_t vertex_count,
+                                     uint64_t seed) {
+  Aads::GeneratorRandom rnd(seed);
+  std::vector<uint32_t> vertices(count);
+  for (uint32_t& vertex : vertices) {
+    vertex = rnd.Below(vertex_count);
+  }
+  return vertices;
+}
+
+void ExpectTablesEqual(const Aads::DistanceTable& lhs,
+                       const Aads::DistanceTable& rhs) {
+  ASSERT_EQ(lhs.CountSources(), rhs.CountSources());
+  ASSERT_EQ(lhs.CountTargets(), rhs.CountTargets());
+  for (size_t source = 0; source < lhs.CountSources(); ++source) {
+    for (size_t target = 0; target < lhs.CountTargets(); ++target) {
+      EXPECT_EQ(lhs.Get(source, target), rhs.Get(source, target));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(ManyToManyTest, BatchedSameAsSingleRuns) {
+  Aads::StaticGraph graph =
+      BuildStaticGraph(Aads::Grid(20, 20, 1, {0.2, 0.1, 30}));
+  std::vector<uint32_t> sources = RandomVertices(30, 400, 2);
+  std::vector<uint32_t> targets = RandomVertices(40, 400, 3);
+
+  for (size_t threads : {1, 4}) {
+    Aads::DistanceTable table =
+        Aads::BatchedDistances(graph, sources, targets, threads);
+    ASSERT_EQ(table.CountSources(), sources.size());
+    for (size_t source = 0; source < sources.size(); ++source) {
+      std::vector<Aads::Distance> dist =
+          Aads::ShortestDistances(graph, sources[source]);
+      for (size_t target = 0; target < targets.size(); ++target) {
+        EXPECT_EQ(table.Get(source, target), dist[targets[target]]);
+      }
+    }
+  }
+}
+
+TEST(ManyToManyTest, BucketsUndirected) {
+  Aads::StaticGraph graph =
+      BuildStaticGraph(Aads::Grid(25, 25, 4, {0.2, 0.1, 50}));
+  Aads::ContractionHierarchy hierarchy(graph);
+  std::vector<uint32_t> sources = RandomVertices(50, 625, 5);
+  std::vector<uint32_t> targets = RandomVertices(60, 625, 6);
+
+  ExpectTablesEqual(Aads::ManyToManyDistances(hierarchy, sources, targets),
+                    Aads::BatchedDistances(graph, sources, targets));
+}
+
+TEST(ManyToManyTest, BucketsDirected) {
+  Aads::StaticGraph graph =
+      BuildStaticGraph(Aads::ErdosRenyi(300, 900, 7, 20), true);
+  Aads::ContractionHierarchy hierarchy(graph);
+  std::vector<uint32_t> sources = RandomVertices(40, 300, 8);
+  std::vector<uint32_t> targets = RandomVertices(30, 300, 9);
+
+  ExpectTablesEqual(Aads::ManyToManyDistances(hierarchy, sources, targets),
+                    Aads::BatchedDistances(graph, sources, targets));
+}
+
+TEST(ManyToManyTest, EmptyBatch) {
+  Aads::StaticGraph graph = BuildStaticGraph(Aads::LongPath(10, 1));
+  Aads::ContractionHierarchy hierarchy(graph);
+  std::vector<uint32_t> vertices = {1, 2};
+
+  EXPECT_EQ(Aads::BatchedDistances(graph, {}, vertices).CountSources(), 0);
+  EXPECT_EQ(Aads::ManyToManyDistances(hierarchy, vertices, {}).CountTargets(),
+            0);
+}
+
+TEST(ManyToManyTest, NearestFacilityOnPath) {
+  Aads::StaticGraph graph(
+      6, {{0, 1, 1}, {1, 2, 1}, {2, 3, 5}, {3, 4, 1}, {4, 5, 1}});
+  Aads::NearestFacility nearest(graph);
+  std::vector<uint32_t> facilities = {0, 5};
+  nearest.Run(facilities);
+
+  EXPECT_EQ(nearest.GetFacility(2), 0);
+  EXPECT_EQ(nearest.GetDistance(2), 2);
+  EXPECT_EQ(nearest.GetFacility(3), 5);
+  EXPECT_EQ(nearest.GetDistance(3), 2);
+  EXPECT_EQ(nearest.GetDistance(5), 0);
+}
+
+TEST(ManyToManyTest, NearestFacilitySameAsMinimum) {
+  Aads::StaticGraph graph =
+      BuildStaticGraph(Aads::ErdosRenyi(500, 800, 10, 40));
+  std::vector<uint32_t> facilities = RandomVertices(10, 500, 11);
+  Aads::NearestFacility nearest(graph);
+  nearest.Run(facilities);
+
+  std::vector<Aads::Distance> best(500, Aads::kUnreachable);
+  for (uint32_t facility : facilities) {
+    std::vector<Aads::Distance> dist =
+        Aads::ShortestDistances(graph, facility);
+    for (uint32_t vertex = 0; vertex < 500; ++vertex) {
+      best[vertex] = std::min(best[vertex], dist[vertex]);
+    }
+  }
+
+  for (uint32_t vertex = 0; vertex < 500; ++vertex) {
+    EXPECT_EQ(nearest.GetDistance(vertex), best[vertex]);
+    if (best[vertex] == Aads::kUnreachable) {
+      EXPECT_EQ(nearest.GetFacility(vertex),
+                Aads::NearestFacility::kNoFacility);
+    } else {
+      std::vector<Aads::Distance> dist =
+          Aads::ShortestDistances(graph, nearest.GetFacility(vertex));
+      EXPECT_EQ(dist[vertex], best[vertex]);
+    }
+  }
+}
@@ -0,0 +1,474 @@
+#ifndef MAX_FLOW_HPP
+#define MAX_FLOW_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "Khun/khun.hpp"
+
+namespace Aads {
+
+struct FlowEdge {
+  uint32_t from;
+  uint32_t to;
+  int64_t capacity;
+};
+
+// Residual graph in CSR form. Every edge is a forward arc in the range of
+// its tail and a reverse arc with zero capacity in the range of its head,
+// and each arc knows the index of its pair
+class FlowNetwork {
+ public:
+  FlowNetwork(size_t vertex_count, const std::vector<FlowEdge>& edges)
+      : offsets_(vertex_count + 1, 0), edge_arc_(edges.size()) {
+    for (const FlowEdge& edge : edges) {
+      offsets_[edge.from + 1] += 1;
+      offsets_[edge.to + 1] += 1;
+    }
+    for (size_t vertex = 0; vertex < vertex_count; ++vertex) {
+      offsets_[vertex + 1] += offsets_[vertex];
+    }
+
+    heads_.resize(offsets_.back());
+    capacity_.resize(offsets_.back());
+    reverse_.resize(offsets_.back());
+    std::vector<size_t> fill(offsets_.begin(), offsets_.end() - 1);
+    for (size_t idx = 0; idx < edges.size(); ++idx) {
+      size_t forward = fill[edges[idx].from]++;
+      size_t backward = fill[edges[idx].to]++;
+      heads_[forward] = edges[idx].to;
+      heads_[backward] = edges[idx].from;
+      capacity_[forward] = edges[idx].capacity;
+      capacity_[backward] = 0;
+      reverse_[forward] = backward;
+      reverse_[backward] = forward;
+      edge_arc_[idx] = forward;
+    }
+    residual_ = capacity_;
+  }
+
+  size_t CountVertices() const { return offsets_.size() - 1; }
+  size_t CountEdges() const { return edge_arc_.size(); }
+
+  // Flow on the edge with the given index in the constructor list
+  int64_t GetFlow(size_t edge) const {
+    size_t arc = edge_arc_[edge];
+    return capacity_[arc] - residual_[arc];
+  }
+
+  void ResetFlow() { residual_ = capacity_; }
+
+  // Arcs of vertex are FirstArc(vertex)..FirstArc(vertex + 1)-1
+  size_t FirstArc(uint32_t vertex) const { return offsets_[vertex]; }
+  uint32_t Head(size_t arc) const { return heads_[arc]; }
+  uint32_t Tail(size_t arc) const { return heads_[reverse_[arc]]; }
+  size_t Reverse(size_t arc) const { return reverse_[arc]; }
+  int64_t Residual(size_t arc) const { return residual_[arc]; }
+
+  void Push(size_t arc, int64_t amount) {
+    residual_[arc] -= amount;
+    residual_[reverse_[arc]] += amount;
+  }
+
+ private:
+  std::vector<size_t> offsets_;
+  std::vector<uint32_t> heads_;
+  std::vector<int64_t> capacity_;
+  std::vector<int64_t> residual_;
+  std::vector<size_t> reverse_;
+  std::vector<size_t> edge_arc_;
+};
+
+namespace {
+
+class DinicSolver {
+ public:
+  explicit DinicSolver(FlowNetwork& network)
+      : network_(network),
+        level_(network.CountVertices()),
+        current_(network.CountVertices()) {}
+
+  int64_t Run(uint32_t source, uint32_t sink) {
+    int64_t flow = 0;
+    while (BuildLevels(source, sink)) {
+      for (uint32_t vertex = 0; vertex < network_.CountVertices(); ++vertex) {
+        current_[vertex] = network_.FirstArc(vertex);
+      }
+      flow += BlockingFlow(source, sink);
+    }
+    return flow;
+  }
+
+ private:
+  static constexpr uint32_t kNoLevel = std::numeric_limits<uint32_t>::max();
+
+  // BFS distances from the source by arcs with residual capacity
+  bool BuildLevels(uint32_t source, uint32_t sink) {
+    std::fill(level_.begin(), level_.end(), kNoLevel);
+    queue_.assign(1, source);
+    level_[source] = 0;
+
+    for (size_t head = 0; head < queue_.size(); ++head) {
+      uint32_t vertex = queue_[head];
+      for (size_t arc = network_.FirstArc(vertex);
+           arc < network_.FirstArc(vertex + 1); ++arc) {
+        uint32_t next = network_.Head(arc);
+        if (network_.Residual(arc) > 0 and level_[next] == kNoLevel) {
+          level_[next] = level_[vertex] + 1;
+          queue_.push_back(next);
+        }
+      }
+    }
+    return level_[sink] != kNoLevel;
+  }
+
+  // Iterative DFS along the levels. After an augmentation it retreats to
+  // the tail of the first saturated arc, and a vertex without a path to
+  // the sink leaves the levels
+  int64_t BlockingFlow(uint32_t source, uint32_t sink) {
+    int64_t flow = 0;
+    path_.clear();
+    uint32_t vertex = source;
+
+    while (true) {
+      if (vertex == sink) {
+        int64_t bottleneck = std::numeric_limits<int64_t>::max();
+        for (size_t arc : path_) {
+          bottleneck = std::min(bottleneck, network_.Residual(arc));
+        }
+        size_t saturated = path_.size();
+        for (size_t idx = 0; idx < path_.size(); ++idx) {
+          network_.Push(path_[idx], bottleneck);
+          if (saturated == path_.size() and
+              network_.Residual(path_[idx]) == 0) {
+            saturated = idx;
+          }
+        }
+        flow += bottleneck;
+        vertex = network_.Tail(path_[saturated]);
+        path_.resize(saturated);
+        continue;
+      }
+
+      size_t end = network_.FirstArc(vertex + 1);
+      size_t& arc = current_[vertex];
+      while (arc < end and
+             (network_.Residual(arc) == 0 or
+              level_[network_.Head(arc)] != level_[vertex] + 1)) {
+        arc += 1;
+      }
+      if (arc < end) {
+        path_.push_back(arc);
+        vertex = network_.Head(arc);
+        continue;
+      }
+
+      if (vertex == source) {
+        break;
+      }
+      level_[vertex] = kNoLevel;
+      vertex = network_.Tail(path_.back());
+      path_.pop_back();
+      current_[vertex] += 1;
+    }
+    return flow;
+  }
+
+  FlowNetwork& network_;
+  std::vector<uint32_t> level_;
+  std::vector<size_t> current_;
+  std::vector<uint32_t> queue_;
+  std::vector<size_t> path_;
+};
+
+// Highest-label push-relabel. Labels below n estimate the distance to the
+// sink, labels n..2n-1 the distance back to the source, so the preflow ends
+// as a flow
+class PushRelabelSolver {
+ public:
+  explicit PushRelabelSolver(FlowNetwork& network)
+      : network_(network),
+        size_(network.CountVertices()),
+        label_(size_),
+        excess_(size_, 0),
+        current_(size_),
+        count_(2 * size_ + 1),
+        active_(2 * size_ + 1) {}
+
+  int64_t Run(uint32_t source, uint32_t sink) {
+    source_ = source;
+    sink_ = sink;
+    for (size_t arc = network_.FirstArc(source);
+         arc < network_.FirstArc(source + 1); ++arc) {
+      int64_t amount = network_.Residual(arc);
+      if (amount > 0) {
+        network_.Push(arc, amount);
+        excess_[network_.Head(arc)] += amount;
+        excess_[source] -= amount;
+      }
+    }
+    GlobalRelabel();
+
+    while (true) {
+      while (max_active_ > 0 and active_[max_active_].empty()) {
+        max_active_ -= 1;
+      }
+      if (active_[max_active_].empty()) {
+        break;
+      }
+      uint32_t vertex = active_[max_active_].back();
+      active_[max_active_].pop_back();
+      // Stale entry of a vertex relabeled by a gap or already discharged
+      if (label_[vertex] != max_active_ or excess_[vertex] == 0) {
+        continue;
+      }
+      Discharge(vertex);
+      if (relabels_ >= size_) {
+        GlobalRelabel();
+      }
+    }
+
+    return excess_[sink];
+  }
+
+ private:
+  void Activate(uint32_t vertex) {
+    if (vertex == source_ or vertex == sink_ or label_[vertex] >= 2 * size_) {
+      return;
+    }
+    active_[label_[vertex]].push_back(vertex);
+    max_active_ = std::max(max_active_, label_[vertex]);
+  }
+
+  void Discharge(uint32_t vertex) {
+    while (excess_[vertex] > 0) {
+      size_t& arc = current_[vertex];
+      if (arc == network_.FirstArc(vertex + 1)) {
+        Relabel(vertex);
+        if (label_[vertex] >= 2 * size_) {
+          return;
+        }
+        arc = network_.FirstArc(vertex);
+        continue;
+      }
+
+      uint32_t next = network_.Head(arc);
+      if (network_.Residual(arc) > 0 and
+          label_[vertex] == label_[next] + 1) {
+        int64_t amount = std::min(excess_[vertex], network_.Residual(arc));
+        bool was_active = excess_[next] > 0;
+        network_.Push(arc, amount);
+        excess_[vertex] -= amount;
+        excess_[next] += amount;
+        if (not was_active) {
+          Activate(next);
+        }
+      } else {
+        arc += 1;
+      }
+    }
+  }
+
+  void Relabel(uint32_t vertex) {
+    relabels_ += 1;
+    size_t old_label = label_[vertex];
+    size_t new_label = 2 * size_;
+    for (size_t arc = network_.FirstArc(vertex);
+         arc < network_.FirstArc(vertex + 1); ++arc) {
+      if (network_.Residual(arc) > 0) {
+        new_label = std::min(new_label, label_[network_.Head(arc)] + 1);
+      }
+    }
+    SetLabel(vertex, new_label);
+
+    // Gap: no vertex is left at old_label, so vertices above it can't reach
+    // the sink any more
+    if (old_label < size_ and count_[old_label] == 0) {
+      for (uint32_t other = 0; other < size_; ++other) {
+        if (label_[other] > old_label and label_[other] < size_) {
+          SetLabel(other, size_);
+          if (excess_[other] > 0 and other != vertex) {
+            Activate(other);
+          }
+        }
+      }
+    }
+  }
+
+  void SetLabel(uint32_t vertex, size_t label) {
+    count_[label_[vertex]] -= 1;
+    label_[vertex] = label;
+    count_[label] += 1;
+  }
+
+  // Exact labels: BFS distances to the sink by residual arcs, and for
+  // vertices that can't reach it n + the distance to the source
+  void GlobalRelabel() {
+    relabels_ = 0;
+    std::fill(label_.begin(), label_.end(), 2 * size_);
+    std::fill(count_.begin(), count_.end(), 0);
+    for (auto& bucket : active_) {
+      bucket.clear();
+    }
+    max_active_ = 0;
+
+    label_[sink_] = 0;
+    label_[source_] = size_;
+    Bfs(sink_);
+    Bfs(source_);
+
+    for (uint32_t vertex = 0; vertex < size_; ++vertex) {
+      count_[label_[vertex]] += 1;
+      current_[vertex] = network_.FirstArc(vertex);
+      if (excess_[vertex] > 0) {
+        Activate(vertex);
+      }
+    }
+  }
+
+  // Labels unlabeled vertices that have a residual path to start
+  void Bfs(uint32_t start) {
+    queue_.assign(1, start);
+    for (size_t head = 0; head < queue_.size(); ++head) {
+      uint32_t vertex = queue_[head];
+      for (size_t arc = network_.FirstArc(vertex);
+           arc < network_.FirstArc(vertex + 1); ++arc) {
+        uint32_t prev = network_.Head(arc);
+        // The pair of arc goes from prev to vertex
+        if (label_[prev] == 2 * size_ and
+            network_.Residual(network_.Reverse(arc)) > 0) {
+          label_[prev] = label_[vertex] + 1;
+          queue_.push_back(prev);
+        }
+      }
+    }
+  }
+
+  FlowNetwork& network_;
+  size_t size_;
+  uint32_t source_ = 0;
+  uint32_t sink_ = 0;
+  std::vector<size_t> label_;
+  std::vector<int64_t> excess_;
+  std::vector<size_t> current_;
+  // Number of vertices with every label
+  std::vector<size_t> count_;
+  // Active vertices by label, may hold stale entries
+  std::vector<std::vector<uint32_t>> active_;
+  size_t max_active_ = 0;
+  size_t relabels_ = 0;
+  std::vector<uint32_t> queue_;
+};
+
+}  // namespace
+
+// Maximum flow value from source to sink by Dinic's algorithm, O(V^2 E) and
+// O(E sqrt(V)) on unit networks. The flow is left in network
+inline int64_t DinicMaxFlow(FlowNetwork& network, uint32_t source,
+                            uint32_t sink) {
+  if (source == sink) {
+    return 0;
+  }
+  return DinicSolver(network).Run(source, sink);
+}
+
+// The same by highest-label push-relabel with global relabeling and the gap
+// heuristic, O(V^2 sqrt(E))
+inline int64_t PushRelabelMaxFlow(FlowNetwork& network, uint32_t source,
+                                  uint32_t sink) {
+  if (source == sink) {
+    return 0;
+  }
+  return PushRelabelSolver(network).Run(source, sink);
+}
+
+// Source side of a minimum cut after a maximum flow: vertices reachable
+// from the source by arcs with residual capacity. Edges from this side to
+// the other one are the cut
+inline std::vector<bool> MinCut(const FlowNetwork& network, uint32_t source) {
+  std::vector<bool> reached(network.CountVertices(), false);
+  std::vector<uint32_t> queue = {source};
+  reached[source] = true;
+
+  for (size_t head = 0; head < queue.size(); ++head) {
+    uint32_t vertex = queue[head];
+    for (size_t arc = network.FirstArc(vertex);
+         arc < network.FirstArc(vertex + 1); ++arc) {
+      uint32_t next = network.Head(arc);
+      if (network.Residual(arc) > 0 and not reached[next]) {
+        reached[next] = true;
+        queue.push_back(next);
+      }
+    }
+  }
+  return reached;
+}
+
+// Maximum matching as a unit flow from a source through left and right
+// vertices to a sink, solved by push-relabel. Works on the same graphs as
+// KuhnMaxMatching and replaces the content of matching
+template <typename Graph>
+size_t PushRelabelMaxMatching(const Graph& graph, Matching& matching) {
+  size_t left_count = graph.CountLeft();
+  size_t right_count = graph.CountRight();
+  uint32_t source = left_count + right_count;
+  uint32_t sink = source + 1;
+
+  std::vector<FlowEdge> edges;
+  for (uint32_t left = 0; left < left_count; ++left) {
+    edges.push_back({source, left, 1});
+  }
+  size_t first_inner = edges.size();
+  for (uint32_t left = 0; left < left_count; ++left) {
+    for (uint32_t right : graph.GetAdj(left)) {
+      edges.push_back({left, static_cast<uint32_t>(left_count + right), 1});
+    }
+  }
+  size_t end_inner = edges.size();
+  for (uint32_t right = 0; right < right_count; ++right) {
+    edges.push_back({static_cast<uint32_t>(left_count + right), sink, 1});
+  }
+
+  FlowNetwork network(sink + 1, edges);
+  PushRelabelMaxFlow(network, source, sink);
+
+  matching = Matching(left_count, right_count);
+  for (size_t edge = first_inner; edge < end_inner; ++edge) {
+    if (network.GetFlow(edge) > 0) {
+      matching.Match(edges[edge].from, edges[edge].to - left_count);
+    }
+  }
+  return matching.Size();
+}
+
+// Drop-in replacement of FindMaxMatching from Khun/khun.hpp, through
+// BipartiteGraph and push-relabel
+template <typename BipartitionGraph, typename Vertex, typename VertexHash>
+std::unordered_map<Vertex, Vertex, VertexHash> FindMaxMatchingPushRelabel(
+    const BipartitionGraph& graph) {
+  std::vector<Vertex> right_vertices;
+  BipartiteGraph dense =
+      BipartiteGraph::FromGraph<BipartitionGraph, Vertex, VertexHash>(
+          graph, right_vertices);
+  Matching dense_matching;
+  PushRelabelMaxMatching(dense, dense_matching);
+
+  std::unordered_map<Vertex, Vertex, VertexHash> matching;
+  matching.reserve(dense_matching.Size());
+  auto left_part = graph.LeftPart();
+  for (uint32_t left = 0; left < left_part.size(); ++left) {
+    if (not dense_matching.IsLeftFree(left)) {
+      matching.emplace(right_vertices[dense_matching.MatchOfLeft(left)],
+                       left_part[left]);
+    }
+  }
+  return matching;
+}
+
+}  // namespace Aads
+
+#endif  // MAX_FLOW_HPP
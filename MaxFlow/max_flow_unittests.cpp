@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "HopcroftKarp/hopcroft_karp.hpp"
+#include "MaxFlow/max_flow.hpp"
+
+namespace {
+
+std::vector<Aads::FlowEdge> RandomNetwork(size_t vertices, size_t edges,
+                                          uint32_t seed) {
+  std::mt19937 rnd(seed);
+  std::vector<Aads::FlowEdge> res;
+  for (size_t idx = 0; idx < edges; ++idx) {
+    res.push_back({static_cast<uint32_t>(rnd() % vertices),
+                   static_cast<uint32_t>(rnd() % vertices),
+                   static_cast<int64_t>(rnd() % 100)});
+  }
+  return res;
+}
+
+// Capacity limits, conservation, the value and a cut of the same capacity
+void ExpectMaxFlow(const Aads::FlowNetwork& network,
+                   const std::vector<Aads::FlowEdge>& edges, uint32_t source,
+                   uint32_t sink, int64_t value) {
+  std::vector<int64_t> balance(network.CountVertices(), 0);
+  for (size_t edge = 0; edge < edges.size(); ++edge) {
+    int64_t flow = network.GetFlow(edge);
+    EXPECT_GE(flow, 0);
+    EXPECT_LE(flow, edges[edge].capacity);
+    balance[edges[edge].from] -= flow;
+    balance[edges[edge].to] += flow;
+  }
+  for (uint32_t vertex = 0; vertex < balance.size(); ++vertex) {
+    if (vertex != source and vertex != sink) {
+      EXPECT_EQ(balance[vertex], 0);
+    }
+  }
+  EXPECT_EQ(balance[sink], value);
+
+  std::vector<bool> cut = Aads::MinCut(network, source);
+  EXPECT_TRUE(cut[source]);
+  EXPECT_FALSE(cut[sink]);
+  int64_t cut_capacity = 0;
+  for (const Aads::FlowEdge& edge : edges) {
+    if (cut[edge.from] and not cut[edge.to]) {
+      cut_capacity += edge.capacity;
+    }
+  }
+  EXPECT_EQ(cut_capacity, value);
+}
+
+}  // namespace
+
+TEST(MaxFlowTest, Simple) {
+  std::vector<Aads::FlowEdge> edges = {{0, 1, 3}, {0, 2, 2}, {1, 2, 5},
+                                       {1, 3, 2}, {2, 3, 3}};
+  Aads::FlowNetwork network(4, edges);
+
+  EXPECT_EQ(Aads::DinicMaxFlow(network, 0, 3), 5);
+  ExpectMaxFlow(network, edges, 0, 3, 5);
+
+  network.ResetFlow();
+  EXPECT_EQ(network.GetFlow(0), 0);
+  EXPECT_EQ(Aads::PushRelabelMaxFlow(network, 0, 3), 5);
+  ExpectMaxFlow(network, edges, 0, 3, 5);
+}
+
+TEST(MaxFlowTest, NoPathAndSameEnds) {
+  std::vector<Aads::FlowEdge> edges = {{0, 1, 3}, {2, 1, 4}};
+  Aads::FlowNetwork network(3, edges);
+
+  EXPECT_EQ(Aads::DinicMaxFlow(network, 0, 2), 0);
+  EXPECT_EQ(Aads::PushRelabelMaxFlow(network, 0, 2), 0);
+  ExpectMaxFlow(network, edges, 0, 2, 0);
+  EXPECT_EQ(Aads::PushRelabelMaxFlow(network, 1, 1), 0);
+}
+
+TEST(MaxFlowTest, DinicSameAsPushRelabel) {
+  for (uint32_t seed = 0; seed < 20; ++seed) {
+    std::vector<Aads::FlowEdge> edges = RandomNetwork(30, 120, seed);
+    Aads::FlowNetwork dinic(30, edges);
+    Aads::FlowNetwork push_relabel(30, edges);
+
+    int64_t value = Aads::DinicMaxFlow(dinic, 0, 29);
+    EXPECT_EQ(Aads::PushRelabelMaxFlow(push_relabel, 0, 29), value);
+    ExpectMaxFlow(dinic, edges, 0, 29, value);
+    ExpectMaxFlow(push_relabel, edges, 0, 29, value);
+  }
+}
+
+TEST(MaxFlowTest, LargeNetwork) {
+  std::vector<Aads::FlowEdge> edges = RandomNetwork(2000, 20'000, 99);
+  Aads::FlowNetwork dinic(2000, edges);
+  Aads::FlowNetwork push_relabel(2000, edges);
+
+  int64_t value = Aads::DinicMaxFlow(dinic, 0, 1);
+  EXPECT_GT(value, 0);
+  EXPECT_EQ(Aads::PushRelabelMaxFlow(push_relabel, 0, 1), value);
+  ExpectMaxFlow(push_relabel, edges, 0, 1, value);
+}
+
+TEST(MaxFlowTest, Matching) {
+  std::mt19937 rnd(3);
+  for (size_t iter = 0; iter < 10; ++iter) {
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    for (size_t idx = 0; idx < 200; ++idx) {
+      edges.emplace_back(rnd() % 100, rnd() % 80);
+    }
+    Aads::BipartiteGraph graph(100, 80, edges);
+
+    Aads::Matching expected(100, 80);
+    Aads::Matching matching;
+    EXPECT_EQ(Aads::PushRelabelMaxMatching(graph, matching),
+              Aads::HopcroftKarp().Run(graph, expected));
+    for (uint32_t left = 0; left < 100; ++left) {
+      if (not matching.IsLeftFree(left)) {
+        EXPECT_EQ(matching.MatchOfRight(matching.MatchOfLeft(left)), left);
+      }
+    }
+  }
+
+  Aads::GraphT hashed;
+  for (size_t idx = 0; idx < 3; ++idx) {
+    hashed.AddVertexToLeft({idx, false});
+    hashed.AddEdge({{idx, false}, {idx, true}});
+    hashed.AddEdge({{idx, false}, {(idx + 1) % 3, true}});
+  }
+  auto res = Aads::FindMaxMatchingPushRelabel<Aads::GraphT, Aads::Vertex,
+                                              Aads::VertexHash>(hashed);
+  EXPECT_EQ(res.size(), 3);
+}
@@ -0,0 +1,121 @@
+#ifndef MULTI_QUEUE_HPP
+#define MULTI_QUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "Heap/heap.hpp"
+
+namespace Aads {
+
+// Relaxed concurrent priority queue: c * T sequential heaps, each behind its
+// own lock. Push goes to a random heap, TryPop takes the greater of the tops
+// of two random heaps. Locks are only tried, never waited for: a busy heap
+// means another random pick. Pops are not strictly in order, but the rank of
+// a popped element among all elements is O(number of heaps) in expectation
+template <typename T, typename Compare = std::less<T>>
+class MultiQueue {
+ public:
+  // threads = 0 means std::thread::hardware_concurrency()
+  explicit MultiQueue(size_t threads = 0, size_t queues_per_thread = 2,
+                      const Compare& compare = Compare())
+      : compare_(compare) {
+    if (threads == 0) {
+      threads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    size_t count = std::max<size_t>(threads * queues_per_thread, 1);
+    queues_ = std::vector<Queue>(count);
+    for (Queue& queue : queues_) {
+      queue.heap = Heap<T, Compare>(compare);
+    }
+  }
+
+  void Push(T value) {
+    while (true) {
+      Queue& queue = queues_[Random() % queues_.size()];
+      std::unique_lock lock(queue.mutex, std::try_to_lock);
+      if (lock.owns_lock()) {
+        queue.heap.Insert(std::move(value));
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+    }
+  }
+
+  // Returns std::nullopt if the queue is empty
+  std::optional<T> TryPop() {
+    while (size_.load(std::memory_order_relaxed) > 0) {
+      size_t lhs = Random() % queues_.size();
+      size_t rhs = Random() % queues_.size();
+      if (lhs == rhs) {
+        rhs = (rhs + 1) % queues_.size();
+      }
+
+      std::unique_lock lhs_lock(queues_[lhs].mutex, std::try_to_lock);
+      if (not lhs_lock.owns_lock()) {
+        continue;
+      }
+      std::unique_lock rhs_lock(queues_[rhs].mutex, std::defer_lock);
+      if (rhs != lhs and not rhs_lock.try_lock()) {
+        continue;
+      }
+
+      Heap<T, Compare>* best = Better(queues_[lhs].heap, queues_[rhs].heap);
+      if (best != nullptr) {
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        return best->Pop();
+      }
+    }
+    return std::nullopt;
+  }
+
+  // Exact when no other thread pushes or pops
+  size_t Size() const { return size_.load(std::memory_order_relaxed); }
+  bool Empty() const { return Size() == 0; }
+
+  size_t CountQueues() const { return queues_.size(); }
+
+ private:
+  // Padded to a cache line, so threads working on neighbour heaps don't
+  // invalidate each other's lines
+  struct alignas(64) Queue {
+    std::mutex mutex;
+    Heap<T, Compare> heap;
+  };
+
+  Heap<T, Compare>* Better(Heap<T, Compare>& lhs, Heap<T, Compare>& rhs) {
+    if (lhs.Empty()) {
+      return rhs.Empty() ? nullptr : &rhs;
+    }
+    if (rhs.Empty() or not compare_(lhs.GetMax(), rhs.GetMax())) {
+      return &lhs;
+    }
+    return &rhs;
+  }
+
+  // xorshift64, one state per thread
+  static uint64_t Random() {
+    thread_local uint64_t state =
+        std::hash<std::thread::id>()(std::this_thread::get_id()) |
+        0x9E3779B97F4A7C15ULL;
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  }
+
+  [[no_unique_address]] Compare compare_;
+  std::vector<Queue> queues_;
+  std::atomic<size_t> size_ = 0;
+};
+
+}  // namespace Aads
+
+#endif  // MULTI_QUEUE_HPP
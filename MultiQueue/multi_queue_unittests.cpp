@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "MultiQueue/multi_queue.hpp"
+
+TEST(MultiQueueTest, SingleQueueIsExact) {
+  Aads::MultiQueue<int> queue(1, 1);
+  EXPECT_EQ(queue.CountQueues(), 1);
+  EXPECT_EQ(queue.TryPop(), std::nullopt);
+
+  for (int value : {4, 9, 1, 7}) {
+    queue.Push(value);
+  }
+  EXPECT_EQ(queue.Size(), 4);
+  for (int value : {9, 7, 4, 1}) {
+    EXPECT_EQ(queue.TryPop(), value);
+  }
+  EXPECT_TRUE(queue.Empty());
+}
+
+TEST(MultiQueueTest, BoundedRankError) {
+  const int count = 20'000;
+  Aads::MultiQueue<int, std::greater<int>> queue(4, 2);
+  std::set<int> remaining;
+  for (int value = 0; value < count; ++value) {
+    queue.Push(value);
+    remaining.insert(value);
+  }
+
+  size_t total_rank = 0;
+  while (auto value = queue.TryPop()) {
+    // Rank 0 is the smallest remaining element
+    total_rank += std::distance(remaining.begin(), remaining.find(*value));
+    remaining.erase(*value);
+  }
+
+  EXPECT_TRUE(remaining.empty());
+  EXPECT_LT(total_rank / count, 4 * queue.CountQueues());
+}
+
+TEST(MultiQueueTest, ConcurrentPushPop) {
+  const int threads = 4;
+  const int per_thread = 20'000;
+  Aads::MultiQueue<int> queue(threads);
+  std::vector<std::vector<int>> popped(threads);
+  std::atomic<int> pushers_done = 0;
+
+  std::vector<std::thread> workers;
+  for (int thread = 0; thread < threads; ++thread) {
+    workers.emplace_back([&, thread]() {
+      for (int i = 0; i < per_thread; ++i) {
+        queue.Push(thread * per_thread + i);
+        if (i % 2 == 1) {
+          if (auto value = queue.TryPop()) {
+            popped[thread].push_back(*value);
+          }
+        }
+      }
+      pushers_done += 1;
+      while (pushers_done < threads or not queue.Empty()) {
+        if (auto value = queue.TryPop()) {
+          popped[thread].push_back(*value);
+        }
+      }
+    });
+  }
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+
+  std::vector<int> all;
+  for (const std::vector<int>& values : popped) {
+    all.insert(all.end(), values.begin(), values.end());
+  }
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), threads * per_thread);
+  for (int i = 0; i < threads * per_thread; ++i) {
+    EXPECT_EQ(all[i], i);
+  }
+}
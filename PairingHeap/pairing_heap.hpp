@@ -0,0 +1,289 @@
+#ifndef PAIRING_HEAP_HPP
+#define PAIRING_HEAP_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Aads {
+
+// Meldable heap: a tree where every node is not less than its children by
+// Compare, children kept in a linked list. Insert and Meld link two roots,
+// Pop merges the children of the root in two passes. Like Heap, the top is
+// the greatest element by Compare. Nodes live in an arena of growing blocks,
+// so handles stay valid until their element is popped
+template <typename T, typename Compare = std::less<T>>
+class PairingHeap {
+  struct Node;
+
+ public:
+  class Handle {
+   public:
+    Handle() = default;
+
+    bool operator==(const Handle& other) const = default;
+
+   private:
+    friend class PairingHeap;
+
+    explicit Handle(Node* node) : node_(node) {}
+
+    Node* node_ = nullptr;
+  };
+
+  explicit PairingHeap(const Compare& compare = Compare())
+      : compare_(compare) {}
+
+  PairingHeap(const PairingHeap&) = delete;
+  PairingHeap& operator=(const PairingHeap&) = delete;
+
+  PairingHeap(PairingHeap&& other) noexcept
+      : compare_(other.compare_),
+        root_(std::exchange(other.root_, nullptr)),
+        size_(std::exchange(other.size_, 0)),
+        blocks_(std::move(other.blocks_)),
+        next_block_size_(other.next_block_size_),
+        free_(std::exchange(other.free_, nullptr)),
+        free_tail_(other.free_tail_) {}
+
+  ~PairingHeap() { Clear(); }
+
+  size_t Size() const { return size_; }
+  bool Empty() const { return size_ == 0; }
+
+  const T& GetMax() const { return root_->value; }
+  Handle Top() const { return Handle(root_); }
+  const T& Get(Handle handle) const { return handle.node_->value; }
+
+  template <typename... Args>
+  Handle Emplace(Args&&... args) {
+    Node* node = Allocate(std::forward<Args>(args)...);
+    root_ = root_ == nullptr ? node : Link(root_, node);
+    size_ += 1;
+    return Handle(node);
+  }
+
+  Handle Insert(const T& value) { return Emplace(value); }
+  Handle Insert(T&& value) { return Emplace(std::move(value)); }
+
+  // Removes the top and returns it. Handles of other elements stay valid
+  T Pop() {
+    Node* root = root_;
+    T res = std::move(root->value);
+    root_ = MergePairs(root->child);
+    Deallocate(root);
+    size_ -= 1;
+    return res;
+  }
+
+  void ExtractMax() { Pop(); }
+
+  // value must not be less than the current one by Compare
+  void IncreaseKey(Handle handle, T value) {
+    Node* node = handle.node_;
+    assert(not compare_(value, node->value));
+    node->value = std::move(value);
+    if (node != root_) {
+      Cut(node);
+      root_ = Link(root_, node);
+    }
+  }
+
+  // value must not be greater than the current one by Compare
+  void DecreaseKey(Handle handle, T value) {
+    Node* node = handle.node_;
+    assert(not compare_(node->value, value));
+    node->value = std::move(value);
+
+    // The children may now be greater than the node
+    Node* children = MergePairs(std::exchange(node->child, nullptr));
+    if (node != root_) {
+      Cut(node);
+      root_ = Link(root_, node);
+    }
+    if (children != nullptr) {
+      root_ = Link(root_, children);
+    }
+  }
+
+  // Moves all elements of other into this heap in O(1), other becomes
+  // empty. Handles of other's elements stay valid and now refer to this heap
+  void Meld(PairingHeap&& other) {
+    if (other.root_ != nullptr) {
+      root_ = root_ == nullptr ? other.root_ : Link(root_, other.root_);
+    }
+    size_ += std::exchange(other.size_, 0);
+    other.root_ = nullptr;
+
+    for (std::unique_ptr<Block>& block : other.blocks_) {
+      blocks_.push_back(std::move(block));
+    }
+    other.blocks_.clear();
+    if (other.free_ != nullptr) {
+      AsFree(other.free_tail_)->next = free_;
+      if (free_ == nullptr) {
+        free_tail_ = other.free_tail_;
+      }
+      free_ = std::exchange(other.free_, nullptr);
+    }
+  }
+
+  // Keeps the arena for reuse
+  void Clear() {
+    std::vector<Node*> stack;
+    if (root_ != nullptr) {
+      stack.push_back(root_);
+    }
+    while (not stack.empty()) {
+      Node* node = stack.back();
+      stack.pop_back();
+      for (Node* child = node->child; child != nullptr;
+           child = child->sibling) {
+        stack.push_back(child);
+      }
+      Deallocate(node);
+    }
+    root_ = nullptr;
+    size_ = 0;
+  }
+
+ private:
+  struct Node {
+    template <typename... Args>
+    explicit Node(Args&&... args) : value(std::forward<Args>(args)...) {}
+
+    T value;
+    // First child
+    Node* child = nullptr;
+    // Next sibling
+    Node* sibling = nullptr;
+    // Previous sibling, or the parent for the first child
+    Node* prev = nullptr;
+  };
+
+  // Raw storage for nodes. A slot holds a node only while it is allocated
+  struct Block {
+    explicit Block(size_t size)
+        : nodes(static_cast<Node*>(::operator new(size * sizeof(Node)))),
+          size(size) {}
+    ~Block() { ::operator delete(nodes); }
+
+    Node* nodes;
+    size_t size;
+    size_t used = 0;
+  };
+
+  static constexpr size_t kFirstBlockSize = 64;
+
+  // A freed slot holds the next free slot instead of a node
+  struct FreeSlot {
+    Node* next;
+  };
+
+  static FreeSlot* AsFree(Node* place) {
+    return std::launder(reinterpret_cast<FreeSlot*>(place));
+  }
+
+  template <typename... Args>
+  Node* Allocate(Args&&... args) {
+    Node* place = nullptr;
+    if (free_ != nullptr) {
+      place = free_;
+      free_ = AsFree(place)->next;
+    } else {
+      if (blocks_.empty() or blocks_.back()->used == blocks_.back()->size) {
+        blocks_.push_back(std::make_unique<Block>(next_block_size_));
+        next_block_size_ *= 2;
+      }
+      place = blocks_.back()->nodes + blocks_.back()->used++;
+    }
+    return new (place) Node(std::forward<Args>(args)...);
+  }
+
+  void Deallocate(Node* node) {
+    node->~Node();
+    new (static_cast<void*>(node)) FreeSlot{free_};
+    if (free_ == nullptr) {
+      free_tail_ = node;
+    }
+    free_ = node;
+  }
+
+  // Links two roots, the lesser one becomes the first child of the other
+  Node* Link(Node* lhs, Node* rhs) {
+    if (compare_(lhs->value, rhs->value)) {
+      std::swap(lhs, rhs);
+    }
+    rhs->sibling = lhs->child;
+    if (lhs->child != nullptr) {
+      lhs->child->prev = rhs;
+    }
+    rhs->prev = lhs;
+    lhs->child = rhs;
+    return lhs;
+  }
+
+  // Detaches a non-root node with its subtree
+  void Cut(Node* node) {
+    if (node->prev->child == node) {
+      node->prev->child = node->sibling;
+    } else {
+      node->prev->sibling = node->sibling;
+    }
+    if (node->sibling != nullptr) {
+      node->sibling->prev = node->prev;
+    }
+    node->sibling = nullptr;
+    node->prev = nullptr;
+  }
+
+  // Links siblings in pairs left to right, then the pairs right to left
+  Node* MergePairs(Node* first) {
+    if (first == nullptr) {
+      return nullptr;
+    }
+    pairs_.clear();
+    while (first != nullptr) {
+      Node* lhs = first;
+      Node* rhs = lhs->sibling;
+      first = rhs == nullptr ? nullptr : rhs->sibling;
+      Detach(lhs);
+      if (rhs == nullptr) {
+        pairs_.push_back(lhs);
+      } else {
+        Detach(rhs);
+        pairs_.push_back(Link(lhs, rhs));
+      }
+    }
+
+    Node* res = pairs_.back();
+    for (size_t idx = pairs_.size() - 1; idx > 0; --idx) {
+      res = Link(pairs_[idx - 1], res);
+    }
+    return res;
+  }
+
+  static void Detach(Node* node) {
+    node->sibling = nullptr;
+    node->prev = nullptr;
+  }
+
+  [[no_unique_address]] Compare compare_;
+  Node* root_ = nullptr;
+  size_t size_ = 0;
+  std::vector<std::unique_ptr<Block>> blocks_;
+  size_t next_block_size_ = kFirstBlockSize;
+  // Freed slots, reused before new ones
+  Node* free_ = nullptr;
+  Node* free_tail_ = nullptr;
+  // Scratch space of MergePairs
+  std::vector<Node*> pairs_;
+};
+
+}  // namespace Aads
+
+#endif  // PAIRING_HEAP_HPP
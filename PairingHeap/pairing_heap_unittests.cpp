@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "PairingHeap/pairing_heap.hpp"
+
+TEST(PairingHeapTest, InsertPop) {
+  Aads::PairingHeap<int> heap;
+  EXPECT_TRUE(heap.Empty());
+  for (int value : {5, 1, 9, 3, 7}) {
+    heap.Insert(value);
+  }
+
+  EXPECT_EQ(heap.Size(), 5);
+  EXPECT_EQ(heap.GetMax(), 9);
+  for (int value : {9, 7, 5, 3, 1}) {
+    EXPECT_EQ(heap.Pop(), value);
+  }
+  EXPECT_TRUE(heap.Empty());
+}
+
+TEST(PairingHeapTest, ChangeKeys) {
+  Aads::PairingHeap<int> heap;
+  auto ten = heap.Insert(10);
+  auto twenty = heap.Insert(20);
+  auto thirty = heap.Insert(30);
+  heap.Insert(15);
+
+  heap.IncreaseKey(ten, 40);
+  EXPECT_EQ(heap.Top(), ten);
+  heap.DecreaseKey(ten, 5);
+  EXPECT_EQ(heap.Top(), thirty);
+  heap.DecreaseKey(thirty, 1);
+  EXPECT_EQ(heap.Get(twenty), 20);
+
+  for (int value : {20, 15, 5, 1}) {
+    EXPECT_EQ(heap.Pop(), value);
+  }
+}
+
+TEST(PairingHeapTest, Meld) {
+  Aads::PairingHeap<std::string, std::greater<std::string>> lhs;
+  Aads::PairingHeap<std::string, std::greater<std::string>> rhs;
+  lhs.Insert("pear");
+  lhs.Insert("fig");
+  auto kiwi = rhs.Insert("kiwi");
+  rhs.Insert("apple");
+
+  lhs.Meld(std::move(rhs));
+  EXPECT_TRUE(rhs.Empty());
+  EXPECT_EQ(lhs.Size(), 4);
+
+  // Handles of the melded heap stay valid
+  lhs.IncreaseKey(kiwi, "banana");
+  for (const char* value : {"apple", "banana", "fig", "pear"}) {
+    EXPECT_EQ(lhs.Pop(), value);
+  }
+
+  rhs.Insert("plum");
+  EXPECT_EQ(rhs.GetMax(), "plum");
+}
+
+TEST(PairingHeapTest, MoveOnly) {
+  auto less = [](const std::unique_ptr<int>& lhs,
+                 const std::unique_ptr<int>& rhs) { return *lhs < *rhs; };
+  Aads::PairingHeap<std::unique_ptr<int>, decltype(less)> heap;
+  heap.Insert(std::make_unique<int>(3));
+  auto handle = heap.Emplace(std::make_unique<int>(1));
+  heap.Insert(std::make_unique<int>(2));
+
+  heap.IncreaseKey(handle, std::make_unique<int>(4));
+  EXPECT_EQ(*heap.Pop(), 4);
+  EXPECT_EQ(*heap.Pop(), 3);
+}
+
+TEST(PairingHeapTest, SameAsSet) {
+  using Heap = Aads::PairingHeap<std::pair<int, int>>;
+  std::mt19937 rnd(2);
+  Heap heap;
+  std::set<std::pair<int, int>> expected;
+  std::vector<Heap::Handle> handles(500);
+  std::vector<int> keys(500, -1);
+
+  for (int step = 0; step < 50'000; ++step) {
+    int idx = rnd() % 500;
+    int key = rnd() % 100'000;
+    if (keys[idx] == -1) {
+      handles[idx] = heap.Insert({key, idx});
+      keys[idx] = key;
+      expected.insert({key, idx});
+    } else if (rnd() % 4 == 0) {
+      ASSERT_EQ(heap.GetMax(), *expected.rbegin());
+      auto [top_key, top_idx] = heap.Pop();
+      keys[top_idx] = -1;
+      expected.erase({top_key, top_idx});
+    } else {
+      expected.erase({keys[idx], idx});
+      if (key > keys[idx]) {
+        heap.IncreaseKey(handles[idx], {key, idx});
+      } else {
+        heap.DecreaseKey(handles[idx], {key, idx});
+      }
+      keys[idx] = key;
+      expected.insert({key, idx});
+    }
+    ASSERT_EQ(heap.Size(), expected.size());
+  }
+
+  heap.Clear();
+  EXPECT_TRUE(heap.Empty());
+  heap.Insert({1, 1});
+  EXPECT_EQ(heap.GetMax(), std::make_pair(1, 1));
+}
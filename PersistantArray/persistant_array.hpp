@@ -1,3 +1,6 @@
+#ifndef PERSISTANT_ARRAY_HPP
+#define PERSISTANT_ARRAY_HPP
+
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
@@ -183,3 +186,5 @@ class PersistentArray {
 };
 
 }  // namespace Aads
+
+#endif  // PERSISTANT_ARRAY_HPP
@@ -0,0 +1,283 @@
+#ifndef POINT_TO_POINT_HPP
+#define POINT_TO_POINT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Dijkstra/dijkstra_engine.hpp"
+
+namespace Aads {
+
+// Searches from the source on the graph and from the target on the reversed
+// graph at the same time, and stops once the two searches can't improve the
+// best meeting point
+class BidirectionalDijkstra {
+ public:
+  // For undirected graphs the reversed graph is the graph itself
+  explicit BidirectionalDijkstra(const StaticGraph& graph)
+      : BidirectionalDijkstra(graph, graph) {}
+
+  BidirectionalDijkstra(const StaticGraph& graph, const StaticGraph& reversed)
+      : forward_(graph), backward_(reversed) {}
+
+  // Returns kUnreachable if there is no path
+  Distance Query(uint32_t source, uint32_t target) {
+    forward_.Reset(source);
+    backward_.Reset(target);
+    best_ = source == target ? 0 : kUnreachable;
+
+    while (not forward_.queue.Empty() and not backward_.queue.Empty()) {
+      // The last popped keys are lower bounds of the remaining ones
+      if (best_ != kUnreachable and
+          forward_.last_key + backward_.last_key >= best_) {
+        break;
+      }
+      if (forward_.last_key <= backward_.last_key) {
+        Step(forward_, backward_);
+      } else {
+        Step(backward_, forward_);
+      }
+    }
+
+    return best_;
+  }
+
+  size_t SettledCount() const {
+    return forward_.settled_count + backward_.settled_count;
+  }
+
+ private:
+  struct Side {
+    explicit Side(const StaticGraph& graph)
+        : graph(graph), workspace(graph.CountVertices()) {}
+
+    void Reset(uint32_t start) {
+      workspace.Reset();
+      queue.Reset(graph);
+      last_key = 0;
+      settled_count = 0;
+      workspace.Relax(start, 0);
+      queue.Push(start, 0);
+    }
+
+    const StaticGraph& graph;
+    SearchWorkspace workspace;
+    RadixHeap queue;
+    Distance last_key = 0;
+    size_t settled_count = 0;
+  };
+
+  void Step(Side& side, const Side& other) {
+    auto [dist, vertex] = side.queue.Pop();
+    side.last_key = dist;
+    if (dist != side.workspace.GetDistance(vertex)) {
+      return;
+    }
+    side.settled_count += 1;
+
+    for (StaticGraph::Arc arc : side.graph.GetAdj(vertex)) {
+      Distance new_dist = dist + arc.weight;
+      if (side.workspace.Relax(arc.to, new_dist)) {
+        side.queue.Push(arc.to, new_dist);
+      }
+      if (other.workspace.IsReached(arc.to)) {
+        best_ = std::min(best_,
+                         new_dist + other.workspace.GetDistance(arc.to));
+      }
+    }
+  }
+
+  Side forward_;
+  Side backward_;
+  Distance best_ = kUnreachable;
+};
+
+// Exact distances from and to a few landmark vertices. By the triangle
+// inequality they give lower bounds on the distance between any two vertices.
+// Landmarks are chosen greedily, each one farthest from the already chosen
+class Landmarks {
+ public:
+  Landmarks(const StaticGraph& graph, size_t count)
+      : Landmarks(graph, graph, count, false) {}
+
+  Landmarks(const StaticGraph& graph, const StaticGraph& reversed,
+            size_t count)
+      : Landmarks(graph, reversed, count, true) {}
+
+  // Lower bound on the distance from vertex to target, kUnreachable if the
+  // landmarks prove that there is no path
+  Distance LowerBound(uint32_t vertex, uint32_t target) const {
+    const std::vector<Distance>& to = is_directed_ ? to_ : from_;
+    Distance bound = 0;
+
+    for (size_t i = 0; i < landmarks_.size(); ++i) {
+      Distance landmark_vertex = from_[vertex * stride_ + i];
+      Distance landmark_target = from_[target * stride_ + i];
+      Distance vertex_landmark = to[vertex * stride_ + i];
+      Distance target_landmark = to[target * stride_ + i];
+
+      // A landmark reaches vertex but not target, or target reaches a
+      // landmark and vertex doesn't
+      if ((landmark_vertex != kUnreachable and
+           landmark_target == kUnreachable) or
+          (target_landmark != kUnreachable and
+           vertex_landmark == kUnreachable)) {
+        return kUnreachable;
+      }
+      // d(l, t) <= d(l, v) + d(v, t)
+      bound = std::max(bound, Difference(landmark_target, landmark_vertex));
+      // d(v, l) <= d(v, t) + d(t, l)
+      bound = std::max(bound, Difference(vertex_landmark, target_landmark));
+    }
+
+    return bound;
+  }
+
+  std::span<const uint32_t> Vertices() const { return landmarks_; }
+
+ private:
+  Landmarks(const StaticGraph& graph, const StaticGraph& reversed,
+            size_t count, bool is_directed)
+      : is_directed_(is_directed),
+        stride_(count),
+        from_(graph.CountVertices() * count, kUnreachable) {
+    if (is_directed_) {
+      to_.assign(graph.CountVertices() * count, kUnreachable);
+    }
+    if (graph.CountVertices() == 0) {
+      return;
+    }
+
+    DijkstraEngine<> forward(graph);
+    DijkstraEngine<> backward(reversed);
+    // Distance from every vertex to the closest chosen landmark
+    std::vector<Distance> closest(graph.CountVertices(), kUnreachable);
+    forward.Run(0);
+    uint32_t next = Farthest(forward, closest);
+
+    while (landmarks_.size() < count) {
+      size_t idx = landmarks_.size();
+      landmarks_.push_back(next);
+
+      forward.Run(next);
+      for (uint32_t vertex : forward.Reached()) {
+        from_[vertex * stride_ + idx] = forward.GetDistance(vertex);
+        closest[vertex] =
+            std::min(closest[vertex], forward.GetDistance(vertex));
+      }
+      if (is_directed_) {
+        backward.Run(next);
+        for (uint32_t vertex : backward.Reached()) {
+          to_[vertex * stride_ + idx] = backward.GetDistance(vertex);
+        }
+      }
+
+      next = Farthest(forward, closest);
+      if (closest[next] == 0) {
+        // Every vertex reachable from the landmarks is a landmark
+        break;
+      }
+    }
+  }
+
+  static uint32_t Farthest(const DijkstraEngine<>& engine,
+                           const std::vector<Distance>& closest) {
+    uint32_t farthest = engine.Reached()[0];
+    for (uint32_t vertex : engine.Reached()) {
+      if (std::min(closest[vertex], engine.GetDistance(vertex)) >
+          std::min(closest[farthest], engine.GetDistance(farthest))) {
+        farthest = vertex;
+      }
+    }
+    return farthest;
+  }
+
+  static Distance Difference(Distance lhs, Distance rhs) {
+    if (lhs == kUnreachable or rhs == kUnreachable or lhs < rhs) {
+      return 0;
+    }
+    return lhs - rhs;
+  }
+
+  bool is_directed_;
+  size_t stride_;
+  std::vector<uint32_t> landmarks_;
+  // from_[vertex * stride_ + i] is the distance from i-th landmark to vertex
+  std::vector<Distance> from_;
+  // to_[vertex * stride_ + i] is the distance from vertex to i-th landmark,
+  // only stored for directed graphs
+  std::vector<Distance> to_;
+};
+
+// A* search with landmark lower bounds as the potential (ALT). The bounds are
+// consistent, so keys popped from the queue are monotone and every vertex is
+// settled at most once
+class AltSearch {
+ public:
+  AltSearch(const StaticGraph& graph, const Landmarks& landmarks)
+      : graph_(graph),
+        landmarks_(landmarks),
+        workspace_(graph.CountVertices()),
+        potential_(graph.CountVertices()) {}
+
+  // Returns kUnreachable if there is no path
+  Distance Query(uint32_t source, uint32_t target) {
+    workspace_.Reset();
+    queue_.Reset(graph_);
+    settled_count_ = 0;
+    target_ = target;
+    Relax(source, 0);
+
+    while (not queue_.Empty()) {
+      auto [key, vertex] = queue_.Pop();
+      Distance dist = workspace_.GetDistance(vertex);
+      if (key != dist + potential_[vertex]) {
+        continue;
+      }
+      settled_count_ += 1;
+      if (vertex == target) {
+        return dist;
+      }
+
+      for (StaticGraph::Arc arc : graph_.GetAdj(vertex)) {
+        Relax(arc.to, dist + arc.weight);
+      }
+    }
+
+    return kUnreachable;
+  }
+
+  size_t SettledCount() const { return settled_count_; }
+
+ private:
+  void Relax(uint32_t vertex, Distance dist) {
+    bool is_new = not workspace_.IsReached(vertex);
+    if (not workspace_.Relax(vertex, dist)) {
+      return;
+    }
+    if (is_new) {
+      potential_[vertex] = landmarks_.LowerBound(vertex, target_);
+    }
+    if (potential_[vertex] == kUnreachable) {
+      return;
+    }
+    queue_.Push(vertex, dist + potential_[vertex]);
+  }
+
+  const StaticGraph& graph_;
+  const Landmarks& landmarks_;
+  SearchWorkspace workspace_;
+  // Valid for touched vertices only. kUnreachable means target can't be
+  // reached from the vertex, such vertices are never pushed
+  std::vector<Distance> potential_;
+  RadixHeap queue_;
+  uint32_t target_ = 0;
+  size_t settled_count_ = 0;
+};
+
+}  // namespace Aads
+
+#endif  // POINT_TO_POINT_HPP
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "GraphGenerators/graph_generators.hpp"
+#include "PointToPoint/point_to_point.hpp"
+
+namespace {
+
+Aads::StaticGraph ToStaticGraph(const Aads::GeneratedGraph& generated,
+                                bool is_directed = false) {
+  std::vector<Aads::Edge<int>> edges;
+  for (const auto& edge : generated.edges) {
+    edges.emplace_back(edge.from, edge.to, edge.weight);
+  }
+  return Aads::StaticGraph(generated.vertex_count, edges, is_directed);
+}
+
+}  // namespace
+
+TEST(PointToPointTest, EngineEarlyTermination) {
+  Aads::StaticGraph graph = ToStaticGraph(Aads::LongPath(100, 1, 5));
+  Aads::DijkstraEngine<> engine(graph);
+
+  Aads::Distance dist = engine.Query(50, 52);
+  EXPECT_EQ(dist, graph.GetAdj(50)[1].weight + graph.GetAdj(51)[1].weight);
+  EXPECT_LE(engine.SettledCount(), 5);
+
+  engine.Run(50);
+  EXPECT_EQ(engine.GetDistance(52), dist);
+  EXPECT_EQ(engine.SettledCount(), 100);
+}
+
+TEST(PointToPointTest, SimpleGraph) {
+  Aads::StaticGraph graph(
+      5, {{0, 1, 10}, {0, 2, 5}, {2, 1, 3}, {1, 3, 1}, {4, 4, 1}});
+  Aads::BidirectionalDijkstra bidirectional(graph);
+  Aads::Landmarks landmarks(graph, 2);
+  Aads::AltSearch alt(graph, landmarks);
+
+  EXPECT_EQ(bidirectional.Query(0, 3), 9);
+  EXPECT_EQ(bidirectional.Query(3, 3), 0);
+  EXPECT_EQ(bidirectional.Query(0, 4), Aads::kUnreachable);
+  EXPECT_EQ(alt.Query(0, 3), 9);
+  EXPECT_EQ(alt.Query(3, 3), 0);
+  EXPECT_EQ(alt.Query(0, 4), Aads::kUnreachable);
+}
+
+TEST(PointToPointTest, SameAsDijkstra) {
+  Aads::StaticGraph graph =
+      ToStaticGraph(Aads::Grid(40, 40, 3, {0.2, 0.1, 50}));
+  Aads::DijkstraEngine<> engine(graph);
+  Aads::BidirectionalDijkstra bidirectional(graph);
+  Aads::Landmarks landmarks(graph, 8);
+  Aads::AltSearch alt(graph, landmarks);
+  Aads::GeneratorRandom rnd(5);
+
+  for (int i = 0; i < 50; ++i) {
+    uint32_t source = rnd.Below(graph.CountVertices());
+    uint32_t target = rnd.Below(graph.CountVertices());
+    engine.Run(source);
+
+    EXPECT_EQ(bidirectional.Query(source, target), engine.GetDistance(target));
+    EXPECT_EQ(alt.Query(source, target), engine.GetDistance(target));
+    EXPECT_LE(landmarks.LowerBound(source, target),
+              engine.GetDistance(target));
+  }
+}
+
+TEST(PointToPointTest, Directed) {
+  Aads::StaticGraph graph =
+      ToStaticGraph(Aads::ErdosRenyi(400, 1600, 8, 20), true);
+  Aads::StaticGraph reversed = graph.Reversed();
+  Aads::DijkstraEngine<> engine(graph);
+  Aads::BidirectionalDijkstra bidirectional(graph, reversed);
+  Aads::Landmarks landmarks(graph, reversed, 4);
+  Aads::AltSearch alt(graph, landmarks);
+
+  for (uint32_t source = 0; source < 400; source += 37) {
+    engine.Run(source);
+    for (uint32_t target = 0; target < 400; target += 13) {
+      EXPECT_EQ(bidirectional.Query(source, target),
+                engine.GetDistance(target));
+      EXPECT_EQ(alt.Query(source, target), engine.GetDistance(target));
+    }
+  }
+}
+
+TEST(PointToPointTest, FewerSettledVertices) {
+  Aads::StaticGraph graph = ToStaticGraph(Aads::Grid(100, 100, 1, {0, 0, 10}));
+  Aads::DijkstraEngine<> engine(graph);
+  Aads::BidirectionalDijkstra bidirectional(graph);
+  Aads::Landmarks landmarks(graph, 8);
+  Aads::AltSearch alt(graph, landmarks);
+
+  EXPECT_EQ(landmarks.Vertices().size(), 8);
+
+  uint32_t source = 50 * 100 + 10;
+  uint32_t target = 50 * 100 + 90;
+  Aads::Distance dist = engine.Query(source, target);
+
+  EXPECT_EQ(bidirectional.Query(source, target), dist);
+  EXPECT_EQ(alt.Query(source, target), dist);
+  EXPECT_LT(bidirectional.SettledCount(), engine.SettledCount());
+  EXPECT_LT(alt.SettledCount() * 3, engine.SettledCount());
+}
@@ -0,0 +1,279 @@
+#ifndef REORDER_HPP
+#define REORDER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <queue>
+#include <vector>
+
+namespace Aads {
+
+// Every pass returns a permutation `perm` where `perm[old_label]` is the new
+// label of the vertex. Passes work on plain adjacency lists, library graphs
+// can be converted with `ToAdjList`.
+using AdjList = std::vector<std::vector<int>>;
+
+namespace {
+
+constexpr size_t kDefaultGorderWindow = 5;
+
+template <typename Adj>
+int AdjTarget(const Adj& adj) {
+  if constexpr (requires { adj.to; }) {
+    return adj.to;
+  } else {
+    return adj;
+  }
+}
+
+template <typename Graph>
+size_t CountGraphVertices(const Graph& graph) {
+  if constexpr (requires { graph.CountVertices(); }) {
+    return graph.CountVertices();
+  } else {
+    return graph.CountVertexs();
+  }
+}
+
+std::vector<int> VerticesByDegree(const AdjList& adj, bool descending) {
+  std::vector<int> vertices(adj.size());
+  std::iota(vertices.begin(), vertices.end(), 0);
+  std::stable_sort(vertices.begin(), vertices.end(), [&](int lhs, int rhs) {
+    return descending ? adj[lhs].size() > adj[rhs].size()
+                      : adj[lhs].size() < adj[rhs].size();
+  });
+  return vertices;
+}
+
+template <typename Visit>
+void BreadthFirstOrder(const AdjList& adj, const std::vector<int>& starts,
+                       Visit&& order_neighbours, std::vector<int>& order) {
+  std::vector<bool> visited(adj.size());
+  std::vector<int> neighbours;
+
+  for (int start : starts) {
+    if (visited[start]) {
+      continue;
+    }
+    visited[start] = true;
+    size_t head = order.size();
+    order.push_back(start);
+
+    while (head < order.size()) {
+      int vertex = order[head++];
+      neighbours.clear();
+      for (int to : adj[vertex]) {
+        if (not visited[to]) {
+          visited[to] = true;
+          neighbours.push_back(to);
+        }
+      }
+      order_neighbours(neighbours);
+      order.insert(order.end(), neighbours.begin(), neighbours.end());
+    }
+  }
+}
+
+// Keeps track of the Gorder score of every unplaced vertex: the number of
+// edges and common neighbours it shares with the vertices in the window.
+class GorderScores {
+ public:
+  explicit GorderScores(const AdjList& adj)
+      : adj_(adj), score_(adj.size()), placed_(adj.size()) {}
+
+  void Place(int vertex) { placed_[vertex] = true; }
+
+  void Enter(int vertex) { Update(vertex, 1); }
+  void Leave(int vertex) { Update(vertex, -1); }
+
+  // Returns -1 if no unplaced vertex shares anything with the window
+  int PopBest() {
+    while (not queue_.empty()) {
+      auto [score, vertex] = queue_.top();
+      queue_.pop();
+      if (not placed_[vertex] and score == score_[vertex]) {
+        return vertex;
+      }
+    }
+    return -1;
+  }
+
+ private:
+  void Update(int vertex, int64_t delta) {
+    for (int to : adj_[vertex]) {
+      Bump(to, delta);
+    }
+    for (int to : adj_[vertex]) {
+      for (int sibling : adj_[to]) {
+        if (sibling != vertex) {
+          Bump(sibling, delta);
+        }
+      }
+    }
+  }
+
+  void Bump(int vertex, int64_t delta) {
+    if (placed_[vertex]) {
+      return;
+    }
+    score_[vertex] += delta;
+    if (score_[vertex] > 0) {
+      queue_.push({score_[vertex], vertex});
+    }
+  }
+
+  const AdjList& adj_;
+  std::vector<int64_t> score_;
+  std::vector<bool> placed_;
+  std::priority_queue<std::pair<int64_t, int>> queue_;
+};
+
+}  // namespace
+
+inline std::vector<int> OrderToPermutation(const std::vector<int>& order) {
+  std::vector<int> perm(order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    perm[order[i]] = i;
+  }
+  return perm;
+}
+
+// Permutation and order are inverse to each other, so the same loop works
+inline std::vector<int> InversePermutation(const std::vector<int>& perm) {
+  return OrderToPermutation(perm);
+}
+
+// Highest degree vertices first, so hubs share cache lines
+inline std::vector<int> DegreeSortOrder(const AdjList& adj) {
+  return OrderToPermutation(VerticesByDegree(adj, true));
+}
+
+inline std::vector<int> BfsOrder(const AdjList& adj) {
+  std::vector<int> starts(adj.size());
+  std::iota(starts.begin(), starts.end(), 0);
+
+  std::vector<int> order;
+  order.reserve(adj.size());
+  BreadthFirstOrder(adj, starts, [](std::vector<int>&) {}, order);
+  return OrderToPermutation(order);
+}
+
+inline std::vector<int> ReverseCuthillMcKeeOrder(const AdjList& adj) {
+  std::vector<int> order;
+  order.reserve(adj.size());
+  BreadthFirstOrder(adj, VerticesByDegree(adj, false),
+                    [&](std::vector<int>& neighbours) {
+                      std::stable_sort(neighbours.begin(), neighbours.end(),
+                                       [&](int lhs, int rhs) {
+                                         return adj[lhs].size() <
+                                                adj[rhs].size();
+                                       });
+                    },
+                    order);
+  std::reverse(order.begin(), order.end());
+  return OrderToPermutation(order);
+}
+
+// Greedy Gorder: the next vertex is the one sharing the most edges and common
+// neighbours with the last `window` placed vertices. Costs O(sum deg^2).
+inline std::vector<int> GorderOrder(const AdjList& adj,
+                                    size_t window = kDefaultGorderWindow) {
+  std::vector<int> seeds = VerticesByDegree(adj, true);
+  std::vector<int> order;
+  order.reserve(adj.size());
+  std::vector<bool> placed(adj.size());
+  GorderScores scores(adj);
+  size_t next_seed = 0;
+
+  while (order.size() < adj.size()) {
+    int vertex = scores.PopBest();
+    if (vertex == -1) {
+      while (placed[seeds[next_seed]]) {
+        next_seed += 1;
+      }
+      vertex = seeds[next_seed];
+    }
+
+    placed[vertex] = true;
+    scores.Place(vertex);
+    order.push_back(vertex);
+    scores.Enter(vertex);
+    if (order.size() > window) {
+      scores.Leave(order[order.size() - window - 1]);
+    }
+  }
+
+  return OrderToPermutation(order);
+}
+
+inline AdjList Relabeled(const AdjList& adj, const std::vector<int>& perm) {
+  AdjList relabeled(adj.size());
+
+  for (size_t vertex = 0; vertex < adj.size(); ++vertex) {
+    std::vector<int>& new_adj = relabeled[perm[vertex]];
+    new_adj.reserve(adj[vertex].size());
+    for (int to : adj[vertex]) {
+      new_adj.push_back(perm[to]);
+    }
+    std::sort(new_adj.begin(), new_adj.end());
+  }
+
+  return relabeled;
+}
+
+// Works with graphs from DFS/, Kosaraju/, LCA/ and Dijkstra/. Vertices are
+// expected to be labeled 0..n-1
+template <typename Graph>
+AdjList ToAdjList(const Graph& graph) {
+  AdjList adj(CountGraphVertices(graph));
+
+  for (size_t vertex = 0; vertex < adj.size(); ++vertex) {
+    for (const auto& edge : graph.GetAdj(vertex)) {
+      adj[vertex].push_back(AdjTarget(edge));
+    }
+  }
+
+  return adj;
+}
+
+template <typename Graph>
+Graph Relabeled(const Graph& graph, const std::vector<int>& perm) {
+  std::vector<int> order = InversePermutation(perm);
+  Graph relabeled;
+  if constexpr (requires { relabeled.SetVerticesCount(perm.size()); }) {
+    relabeled.SetVerticesCount(perm.size());
+  }
+
+  for (int from : order) {
+    // Undirected graphs store every edge twice, a loop twice in one list
+    bool skip_loop = true;
+
+    for (const auto& edge : graph.GetAdj(from)) {
+      int to = AdjTarget(edge);
+      if (not Graph::kIsDirected and to < from) {
+        continue;
+      }
+      if (not Graph::kIsDirected and to == from) {
+        skip_loop = not skip_loop;
+        if (skip_loop) {
+          continue;
+        }
+      }
+
+      if constexpr (requires { edge.weight; }) {
+        relabeled.AddEdge(
+            typename Graph::EdgeT(perm[from], perm[to], edge.weight));
+      } else {
+        relabeled.AddEdge(perm[from], perm[to]);
+      }
+    }
+  }
+
+  return relabeled;
+}
+
+}  // namespace Aads
+
+#endif  // REORDER_HPP
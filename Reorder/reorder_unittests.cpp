@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "Kosaraju/kosaraju.hpp"
+#include "Reorder/reorder.hpp"
+
+namespace {
+
+bool IsPermutation(const std::vector<int>& perm) {
+  std::vector<int> sorted = perm;
+  std::sort(sorted.begin(), sorted.end());
+  for (size_t i = 0; i < sorted.size(); ++i) {
+    if (sorted[i] != static_cast<int>(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int Bandwidth(const Aads::AdjList& adj) {
+  int bandwidth = 0;
+  for (size_t vertex = 0; vertex < adj.size(); ++vertex) {
+    for (int to : adj[vertex]) {
+      bandwidth = std::max(bandwidth, std::abs(to - static_cast<int>(vertex)));
+    }
+  }
+  return bandwidth;
+}
+
+// Path 0 - 1 - ... - n-1 with shuffled labels
+Aads::AdjList ShuffledPath(int size) {
+  std::vector<int> labels(size);
+  std::iota(labels.begin(), labels.end(), 0);
+  std::shuffle(labels.begin(), labels.end(), std::mt19937(42));
+
+  Aads::AdjList adj(size);
+  for (int i = 0; i + 1 < size; ++i) {
+    adj[labels[i]].push_back(labels[i + 1]);
+    adj[labels[i + 1]].push_back(labels[i]);
+  }
+  return adj;
+}
+
+}  // namespace
+
+TEST(ReorderTest, DegreeSortPutsHubsFirst) {
+  Aads::AdjList adj(5);
+  for (int leaf : {0, 1, 2, 4}) {
+    adj[3].push_back(leaf);
+    adj[leaf].push_back(3);
+  }
+
+  std::vector<int> perm = Aads::DegreeSortOrder(adj);
+
+  EXPECT_TRUE(IsPermutation(perm));
+  EXPECT_EQ(perm[3], 0);
+}
+
+TEST(ReorderTest, ReverseCuthillMcKeeRestoresPath) {
+  Aads::AdjList adj = ShuffledPath(100);
+  EXPECT_GT(Bandwidth(adj), 1);
+
+  std::vector<int> perm = Aads::ReverseCuthillMcKeeOrder(adj);
+
+  EXPECT_TRUE(IsPermutation(perm));
+  EXPECT_EQ(Bandwidth(Aads::Relabeled(adj, perm)), 1);
+}
+
+TEST(ReorderTest, BfsOrderVisitsComponentsContiguously) {
+  Aads::AdjList adj(6);
+  adj[0] = {5};
+  adj[5] = {0, 3};
+  adj[3] = {5};
+  adj[1] = {4};
+  adj[4] = {1};
+
+  std::vector<int> perm = Aads::BfsOrder(adj);
+
+  EXPECT_TRUE(IsPermutation(perm));
+  EXPECT_EQ(perm[0], 0);
+  EXPECT_EQ(perm[5], 1);
+  EXPECT_EQ(perm[3], 2);
+  EXPECT_EQ(perm[1], 3);
+  EXPECT_EQ(perm[4], 4);
+  EXPECT_EQ(perm[2], 5);
+}
+
+TEST(ReorderTest, GorderIsPermutation) {
+  Aads::AdjList adj = ShuffledPath(200);
+  std::mt19937 rnd(7);
+  for (int i = 0; i < 300; ++i) {
+    int from = rnd() % adj.size();
+    int to = rnd() % adj.size();
+    adj[from].push_back(to);
+    adj[to].push_back(from);
+  }
+
+  EXPECT_TRUE(IsPermutation(Aads::GorderOrder(adj)));
+  EXPECT_TRUE(IsPermutation(Aads::GorderOrder(adj, 1)));
+  EXPECT_TRUE(IsPermutation(Aads::GorderOrder(Aads::AdjList(3))));
+  EXPECT_TRUE(Aads::GorderOrder(Aads::AdjList()).empty());
+}
+
+TEST(ReorderTest, RelabeledAdjListKeepsEdges) {
+  Aads::AdjList adj = ShuffledPath(50);
+  std::vector<int> perm = Aads::GorderOrder(adj);
+  Aads::AdjList relabeled = Aads::Relabeled(adj, perm);
+
+  for (size_t vertex = 0; vertex < adj.size(); ++vertex) {
+    ASSERT_EQ(adj[vertex].size(), relabeled[perm[vertex]].size());
+    for (int to : adj[vertex]) {
+      const std::vector<int>& new_adj = relabeled[perm[vertex]];
+      EXPECT_NE(std::find(new_adj.begin(), new_adj.end(), perm[to]),
+                new_adj.end());
+    }
+  }
+}
+
+TEST(ReorderTest, CondensateOnRelabeledGraph) {
+  Aads::DirGraph<int> graph;
+  graph.AddEdge(0, 4);
+  graph.AddEdge(4, 2);
+  graph.AddEdge(2, 0);
+  graph.AddEdge(2, 1);
+  graph.AddEdge(1, 3);
+  graph.AddEdge(3, 1);
+  graph.AddEdge(3, 3);
+
+  std::vector<int> perm =
+      Aads::ReverseCuthillMcKeeOrder(Aads::ToAdjList(graph));
+  Aads::DirGraph<int> relabeled = Aads::Relabeled(graph, perm);
+
+  EXPECT_EQ(relabeled.CountEdges(), graph.CountEdges());
+
+  std::vector<int> comps = Aads::Condensate(graph);
+  std::vector<int> new_comps = Aads::Condensate(relabeled);
+  for (int lhs = 0; lhs < 5; ++lhs) {
+    for (int rhs = 0; rhs < 5; ++rhs) {
+      EXPECT_EQ(comps[lhs] == comps[rhs],
+                new_comps[perm[lhs]] == new_comps[perm[rhs]]);
+    }
+  }
+}
@@ -0,0 +1,160 @@
+#ifndef STREAMING_COMPONENTS_HPP
+#define STREAMING_COMPONENTS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DSU/dsu.hpp"
+
+namespace Aads {
+
+struct StreamStats {
+  size_t edges = 0;
+  size_t blocks = 0;
+  size_t bytes = 0;
+  // Edges that merged two different components
+  size_t unions = 0;
+  // Edges with an endpoint out of [0, vertex_count)
+  size_t skipped = 0;
+  double seconds = 0;
+
+  double EdgesPerSecond() const { return seconds > 0 ? edges / seconds : 0; }
+  double BytesPerSecond() const { return seconds > 0 ? bytes / seconds : 0; }
+};
+
+// Connected components of a graph whose edges don't fit in memory. Only the
+// vertex set is kept: edges are consumed in blocks and united in a DSU, so
+// memory is O(V + block_size).
+class StreamingComponents {
+ public:
+  // Binary edge files are sequences of this record
+  using EdgeT = std::pair<uint32_t, uint32_t>;
+
+  static constexpr size_t kDefaultBlockSize = 1 << 16;
+
+  explicit StreamingComponents(size_t vertex_count,
+                               size_t block_size = kDefaultBlockSize)
+      : vertex_count_(vertex_count),
+        component_count_(vertex_count),
+        block_size_(std::max(block_size, static_cast<size_t>(1))),
+        dsu_(vertex_count) {
+    block_.reserve(block_size_);
+  }
+
+  template <std::input_iterator Iter>
+  void AddEdges(Iter begin, Iter end) {
+    auto start = std::chrono::steady_clock::now();
+
+    while (begin != end) {
+      block_.clear();
+      while (begin != end and block_.size() < block_size_) {
+        block_.emplace_back((*begin).first, (*begin).second);
+        ++begin;
+      }
+      stats_.bytes += block_.size() * sizeof(EdgeT);
+      ProcessBlock();
+    }
+
+    stats_.seconds += Elapsed(start);
+  }
+
+  // Reads raw EdgeT records until the end of the stream. Trailing bytes of a
+  // truncated record are ignored
+  void AddEdges(std::istream& stream) {
+    auto start = std::chrono::steady_clock::now();
+
+    while (stream) {
+      block_.resize(block_size_);
+      stream.read(reinterpret_cast<char*>(block_.data()),
+                  block_.size() * sizeof(EdgeT));
+      size_t bytes = stream.gcount();
+      block_.resize(bytes / sizeof(EdgeT));
+      stats_.bytes += bytes;
+      ProcessBlock();
+    }
+
+    stats_.seconds += Elapsed(start);
+  }
+
+  // Returns false if the file can't be opened
+  bool AddEdgesFromFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (not file) {
+      return false;
+    }
+    AddEdges(file);
+    return true;
+  }
+
+  bool AreSame(size_t lhs, size_t rhs) { return dsu_.AreSame(lhs, rhs); }
+
+  size_t ComponentCount() const { return component_count_; }
+
+  // Dense component labels 0..ComponentCount()-1, numbered in order of the
+  // smallest vertex of each component
+  std::vector<size_t> Labels() {
+    const size_t no_label = std::numeric_limits<size_t>::max();
+    std::vector<size_t> labels(vertex_count_, no_label);
+    size_t next_label = 0;
+
+    for (size_t vertex = 0; vertex < vertex_count_; ++vertex) {
+      size_t root = dsu_.Find(vertex);
+      if (labels[root] == no_label) {
+        labels[root] = next_label++;
+      }
+      labels[vertex] = labels[root];
+    }
+
+    return labels;
+  }
+
+  const StreamStats& Stats() const { return stats_; }
+
+ private:
+  void ProcessBlock() {
+    if (block_.empty()) {
+      return;
+    }
+    stats_.blocks += 1;
+    stats_.edges += block_.size();
+
+    for (auto [from, to] : block_) {
+      if (from >= vertex_count_ or to >= vertex_count_) {
+        stats_.skipped += 1;
+        continue;
+      }
+      if (dsu_.AreSame(from, to)) {
+        continue;
+      }
+      dsu_.Unite(from, to);
+      stats_.unions += 1;
+      component_count_ -= 1;
+    }
+  }
+
+  static double Elapsed(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start)
+        .count();
+  }
+
+  size_t vertex_count_;
+  size_t component_count_;
+  size_t block_size_;
+  DSU dsu_;
+  std::vector<EdgeT> block_;
+  StreamStats stats_;
+};
+
+}  // namespace Aads
+
+#endif  // STREAMING_COMPONENTS_HPP
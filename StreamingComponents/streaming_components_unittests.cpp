@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "StreamingComponents/streaming_components.hpp"
+
+using EdgeT = Aads::StreamingComponents::EdgeT;
+
+TEST(StreamingComponentsTest, NoEdges) {
+  Aads::StreamingComponents comps(4);
+
+  EXPECT_EQ(comps.ComponentCount(), 4);
+  EXPECT_EQ(comps.Labels(), std::vector<size_t>({0, 1, 2, 3}));
+  EXPECT_EQ(comps.Stats().edges, 0);
+}
+
+TEST(StreamingComponentsTest, IteratorBlocks) {
+  std::vector<EdgeT> edges = {{0, 1}, {2, 3}, {1, 0}, {4, 5}, {5, 3}};
+  Aads::StreamingComponents comps(7, 2);
+  comps.AddEdges(edges.begin(), edges.end());
+
+  EXPECT_EQ(comps.ComponentCount(), 3);
+  EXPECT_TRUE(comps.AreSame(2, 4));
+  EXPECT_FALSE(comps.AreSame(0, 2));
+  EXPECT_EQ(comps.Labels(), std::vector<size_t>({0, 0, 1, 1, 1, 1, 2}));
+
+  const Aads::StreamStats& stats = comps.Stats();
+  EXPECT_EQ(stats.edges, 5);
+  EXPECT_EQ(stats.blocks, 3);
+  EXPECT_EQ(stats.unions, 4);
+  EXPECT_EQ(stats.bytes, 5 * sizeof(EdgeT));
+  EXPECT_GE(stats.EdgesPerSecond(), 0);
+}
+
+TEST(StreamingComponentsTest, OtherPairTypes) {
+  std::vector<std::pair<int, int>> edges = {{0, 3}, {3, 1}};
+  Aads::StreamingComponents comps(4);
+  comps.AddEdges(edges.begin(), edges.end());
+
+  EXPECT_EQ(comps.ComponentCount(), 2);
+  EXPECT_TRUE(comps.AreSame(0, 1));
+}
+
+TEST(StreamingComponentsTest, SkipsInvalidEdges) {
+  std::vector<EdgeT> edges = {{0, 1}, {1, 10}};
+  Aads::StreamingComponents comps(3);
+  comps.AddEdges(edges.begin(), edges.end());
+
+  EXPECT_EQ(comps.ComponentCount(), 2);
+  EXPECT_EQ(comps.Stats().skipped, 1);
+}
+
+TEST(StreamingComponentsTest, BinaryStream) {
+  std::vector<EdgeT> edges;
+  for (uint32_t i = 0; i + 1 < 1000; i += 2) {
+    edges.push_back({i, i + 1});
+  }
+  std::string data(reinterpret_cast<const char*>(edges.data()),
+                   edges.size() * sizeof(EdgeT));
+  // Truncated record at the end
+  data.push_back('\0');
+
+  std::istringstream stream(data);
+  Aads::StreamingComponents comps(1000, 64);
+  comps.AddEdges(stream);
+
+  EXPECT_EQ(comps.ComponentCount(), 500);
+  EXPECT_EQ(comps.Stats().edges, 500);
+  EXPECT_EQ(comps.Stats().blocks, 8);
+  EXPECT_EQ(comps.Stats().bytes, data.size());
+}
+
+TEST(StreamingComponentsTest, BinaryFile) {
+  std::string path = testing::TempDir() + "streaming_components_edges.bin";
+  {
+    std::vector<EdgeT> edges = {{0, 1}, {1, 2}, {3, 4}};
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(edges.data()),
+               edges.size() * sizeof(EdgeT));
+  }
+
+  Aads::StreamingComponents comps(5);
+  EXPECT_TRUE(comps.AddEdgesFromFile(path));
+  EXPECT_EQ(comps.ComponentCount(), 2);
+  EXPECT_TRUE(comps.AreSame(0, 2));
+
+  EXPECT_FALSE(comps.AddEdgesFromFile(path + ".missing"));
+}
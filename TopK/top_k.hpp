@@ -0,0 +1,158 @@
+#ifndef TOP_K_HPP
+#define TOP_K_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "Heap/heap.hpp"
+
+namespace Aads {
+
+// Keeps the k greatest elements by Compare of a stream. They are stored in
+// a heap whose top is the least of them, the threshold: an element that is
+// not greater than the threshold is rejected by a single comparison
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class TopK {
+ public:
+  explicit TopK(size_t k, const Compare& compare = Compare())
+      : k_(k), compare_(compare) {
+    items_.reserve(k);
+  }
+
+  size_t Capacity() const { return k_; }
+  size_t Size() const { return items_.size(); }
+  bool Full() const { return items_.size() == k_; }
+
+  // The least kept element, valid if Size() > 0
+  const T& Threshold() const { return items_[0]; }
+
+  // Returns true if value is kept
+  bool Push(const T& value) {
+    if (k_ == 0 or (Full() and not Admits(value))) {
+      return false;
+    }
+    Add(value);
+    return true;
+  }
+
+  bool Push(T&& value) {
+    if (k_ == 0 or (Full() and not Admits(value))) {
+      return false;
+    }
+    Add(std::move(value));
+    return true;
+  }
+
+  // Checks blocks of kBlockSize against the threshold before looking at
+  // single elements. The check of a block has no early exit, so for
+  // arithmetic types the compiler vectorizes it. Returns the number of kept
+  // elements
+  template <std::random_access_iterator Iter>
+  size_t PushMany(Iter begin, Iter end) {
+    size_t kept = 0;
+    if (k_ == 0) {
+      return kept;
+    }
+    while (begin != end and not Full()) {
+      kept += Push(*begin++) ? 1 : 0;
+    }
+
+    while (end - begin >= static_cast<std::ptrdiff_t>(kBlockSize)) {
+      bool any = false;
+      for (size_t idx = 0; idx < kBlockSize; ++idx) {
+        any |= Admits(begin[idx]);
+      }
+      if (any) {
+        for (size_t idx = 0; idx < kBlockSize; ++idx) {
+          kept += Push(begin[idx]) ? 1 : 0;
+        }
+      }
+      begin += kBlockSize;
+    }
+
+    while (begin != end) {
+      kept += Push(*begin++) ? 1 : 0;
+    }
+    return kept;
+  }
+
+  // Kept elements from the greatest, the structure becomes empty
+  std::vector<T> TakeSorted() {
+    for (size_t size = items_.size(); size > 1; --size) {
+      std::swap(items_[0], items_[size - 1]);
+      HeapSiftDown<Arity>(items_.begin(), size - 1, 0, Inverted());
+    }
+    return std::exchange(items_, {});
+  }
+
+  void Clear() { items_.clear(); }
+
+ private:
+  static constexpr size_t kBlockSize = 64;
+
+  // Makes the least element the top of the heap
+  auto Inverted() const {
+    return [this](const T& lhs, const T& rhs) { return compare_(rhs, lhs); };
+  }
+
+  bool Admits(const T& value) const { return compare_(items_[0], value); }
+
+  template <typename U>
+  void Add(U&& value) {
+    if (not Full()) {
+      items_.push_back(std::forward<U>(value));
+      HeapSiftUp<Arity>(items_.begin(), items_.size() - 1, Inverted());
+      return;
+    }
+    items_[0] = std::forward<U>(value);
+    HeapSiftDown<Arity>(items_.begin(), items_.size(), 0, Inverted());
+  }
+
+  size_t k_;
+  [[no_unique_address]] Compare compare_;
+  std::vector<T> items_;
+};
+
+// Like std::partial_sort: [begin, middle) gets the least elements of the
+// range in ascending order, the rest is left in unspecified order. A heap of
+// the middle - begin least elements so far rejects most others with one
+// comparison
+template <std::random_access_iterator Iter,
+          typename Compare = std::less<std::iter_value_t<Iter>>,
+          size_t Arity = 4>
+void PartialSort(Iter begin, Iter middle, Iter end,
+                 Compare compare = Compare()) {
+  size_t size = middle - begin;
+  if (size == 0) {
+    return;
+  }
+  MakeHeap<Arity>(begin, size, compare);
+
+  for (Iter it = middle; it != end; ++it) {
+    if (compare(*it, *begin)) {
+      std::iter_swap(it, begin);
+      HeapSiftDown<Arity>(begin, size, 0, compare);
+    }
+  }
+
+  for (; size > 1; --size) {
+    std::iter_swap(begin, begin + (size - 1));
+    HeapSiftDown<Arity>(begin, size - 1, 0, compare);
+  }
+}
+
+// In-place O(n log n) sort, ascending by compare
+template <std::random_access_iterator Iter,
+          typename Compare = std::less<std::iter_value_t<Iter>>,
+          size_t Arity = 4>
+void HeapSort(Iter begin, Iter end, Compare compare = Compare()) {
+  PartialSort<Iter, Compare, Arity>(begin, end, end, compare);
+}
+
+}  // namespace Aads
+
+#endif  // TOP_K_HPP
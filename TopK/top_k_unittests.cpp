@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "TopK/top_k.hpp"
+
+namespace {
+
+std::vector<int> RandomValues(size_t count, uint32_t seed) {
+  std::mt19937 rnd(seed);
+  std::vector<int> values(count);
+  for (int& value : values) {
+    value = rnd() % 1'000'000;
+  }
+  return values;
+}
+
+}  // namespace
+
+TEST(TopKTest, Basic) {
+  Aads::TopK<int> top(3);
+  for (int value : {5, 1, 9, 3, 7, 2}) {
+    top.Push(value);
+  }
+
+  EXPECT_TRUE(top.Full());
+  EXPECT_EQ(top.Threshold(), 5);
+  EXPECT_FALSE(top.Push(4));
+  EXPECT_TRUE(top.Push(6));
+  EXPECT_EQ(top.TakeSorted(), std::vector<int>({9, 7, 6}));
+  EXPECT_EQ(top.Size(), 0);
+}
+
+TEST(TopKTest, SmallStreamAndZeroK) {
+  Aads::TopK<std::string, std::greater<std::string>> top(5);
+  top.Push("pear");
+  top.Push("apple");
+  EXPECT_FALSE(top.Full());
+  EXPECT_EQ(top.TakeSorted(), std::vector<std::string>({"apple", "pear"}));
+
+  Aads::TopK<int> none(0);
+  std::vector<int> values = {1, 2, 3};
+  EXPECT_EQ(none.PushMany(values.begin(), values.end()), 0);
+  EXPECT_TRUE(none.TakeSorted().empty());
+}
+
+TEST(TopKTest, PushManySameAsSort) {
+  std::vector<int> values = RandomValues(100'000, 1);
+  Aads::TopK<int> top(100);
+  top.PushMany(values.begin(), values.begin() + 50'000);
+  top.PushMany(values.begin() + 50'000, values.end());
+
+  std::sort(values.begin(), values.end(), std::greater<int>());
+  values.resize(100);
+  EXPECT_EQ(top.TakeSorted(), values);
+}
+
+TEST(TopKTest, PushManyRejectsSortedStream) {
+  std::vector<int> values(10'000);
+  for (size_t idx = 0; idx < values.size(); ++idx) {
+    values[idx] = values.size() - idx;
+  }
+  Aads::TopK<int> top(10);
+
+  EXPECT_EQ(top.PushMany(values.begin(), values.end()), 10);
+  EXPECT_EQ(top.Threshold(), 9'991);
+}
+
+TEST(TopKTest, PartialSort) {
+  std::vector<int> values = RandomValues(10'000, 2);
+  std::vector<int> expected = values;
+  std::sort(expected.begin(), expected.end());
+
+  Aads::PartialSort(values.begin(), values.begin() + 500, values.end());
+  EXPECT_TRUE(std::equal(values.begin(), values.begin() + 500,
+                         expected.begin()));
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ(values, expected);
+
+  Aads::PartialSort(values.begin(), values.begin(), values.end());
+}
+
+TEST(TopKTest, HeapSort) {
+  std::vector<int> values = RandomValues(10'000, 3);
+  std::vector<int> expected = values;
+  std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+  Aads::HeapSort(values.begin(), values.end(), std::greater<int>());
+  EXPECT_EQ(values, expected);
+
+  std::vector<std::string> words = {"kiwi", "fig", "apple", "date"};
+  Aads::HeapSort<std::vector<std::string>::iterator,
+                 std::less<std::string>, 2>(words.begin(), words.end());
+  EXPECT_EQ(words,
+            std::vector<std::string>({"apple", "date", "fig", "kiwi"}));
+}